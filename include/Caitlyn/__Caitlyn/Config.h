@@ -78,6 +78,19 @@
     #endif
 #endif
 
+//Instruction Sets
+#if defined(__AVX2__)
+    #define __CAITLYN_HAS_AVX2 1
+#else
+    #define __CAITLYN_HAS_AVX2 0
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define __CAITLYN_HAS_SSE2 1
+#else
+    #define __CAITLYN_HAS_SSE2 0
+#endif
+
 //Compiler
 #if defined(__clang__)
     #define __CAITLYN_COMPILER_CLANG
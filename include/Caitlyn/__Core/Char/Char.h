@@ -18,142 +18,159 @@
 #ifndef CAITLYN_CORE_CHAR_CHAR_H_
 #define CAITLYN_CORE_CHAR_CHAR_H_
 
+#include <cstring>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 
 #include "Caitlyn/__Base.h"
+#include "Caitlyn/__Core/String/Utf8.h"
 
 __CAITLYN_GLOBAL_NAMESPACE_BEGIN
 
+// Single UTF-8 encoded code point stored inline
 class Char
 {
 public:
     using ValueType = char;
     using DataType = std::basic_string<ValueType>;
 
+public:
+    static constexpr SizeType MaxSize = 4;
+
 public:
     Char() = default;
 
+    // A single byte is a character only when it is ASCII
     Char(const StdChar byte)
     {
-        data_ = byte;
+        AssignByte(byte);
     }
 
-    Char(const CodePoint codePoint) : data_{FromCodePoint(codePoint)}
+    Char(const CodePoint codePoint)
     {
+        *this = codePoint;
     }
 
     Char(const char* bytes)
     {
-        if (!IsValidUtf8Char(bytes))
-        {
-            throw std::invalid_argument("Invalid UTF-8 character");
-        }
-        data_ = bytes;
+        *this = bytes;
     }
 
-    Char(const DataType& bytes)
+    Char(const char* bytes, const SizeType count)
     {
-        if (!IsValidUtf8Char(bytes))
+        if (!IsValidUtf8Char(bytes, count))
         {
             throw std::invalid_argument("Invalid UTF-8 character");
         }
-        data_ = bytes;
+        Assign(bytes, count);
+    }
+
+    Char(const DataType& bytes) : Char(bytes.data(), bytes.size())
+    {
     }
 
 public:
     Char& operator=(const char byte)
     {
-        data_ = byte;
+        AssignByte(byte);
         return *this;
     }
 
     Char& operator=(const CodePoint codePoint)
     {
-        data_ = FromCodePoint(codePoint);
+        if (codePoint == 0x00)
+        {
+            Assign(nullptr, 0);
+        }
+        else if (codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+        {
+            throw std::invalid_argument("Invalid code point");
+        }
+        else
+        {
+            char bytes[MaxSize];
+            Assign(bytes, __Detail::EncodeUtf8(codePoint, bytes));
+        }
         return *this;
     }
 
     Char& operator=(const char* bytes)
     {
-        if (!IsValidUtf8Char(bytes))
+        const SizeType count = std::strlen(bytes);
+
+        if (!IsValidUtf8Char(bytes, count))
         {
             throw std::invalid_argument("Invalid UTF-8 character");
         }
-        data_ = bytes;
+        Assign(bytes, count);
         return *this;
     }
 
     Char& operator=(const DataType& bytes)
     {
-        if (!IsValidUtf8Char(bytes))
-        {
-            throw std::invalid_argument("Invalid UTF-8 character");
-        }
-        data_ = bytes;
-        return *this;
+        return *this = Char{bytes};
     }
 
     SizeType size() const
     {
-        return data_.size();
+        return size_;
     }
 
     SizeType Length() const
     {
-        return data_.size();
+        return size_;
     }
 
     const char* data() const
     {
-        return data_.data();
+        return data_;
     }
 
     const char* c_str() const
     {
-        return data_.c_str();
+        return data_;
     }
 
     DataType str() const
     {
-        return data_;
+        return DataType(data_, size_);
     }
 
     bool IsEmpty() const
     {
-        return data_.empty();
+        return size_ == 0;
     }
 
     bool NotEmpty() const
     {
-        return !data_.empty();
+        return size_ != 0;
     }
 
     bool operator>(const Char& other) const
     {
-        return data_ > other.data_;
+        return Compare(other) > 0;
     }
 
     bool operator<(const Char& other) const
     {
-        return data_ < other.data_;
+        return Compare(other) < 0;
     }
 
     bool operator>=(const Char& other) const
     {
-        return data_ >= other.data_;
+        return Compare(other) >= 0;
     }
 
     bool operator<=(const Char& other) const
     {
-        return data_ <= other.data_;
+        return Compare(other) <= 0;
     }
 
     bool operator==(const Char& other) const
     {
-        return data_ == other.data_;
+        return size_ == other.size_ && std::memcmp(data_, other.data_, size_) == 0;
     }
 
     bool operator!=(const Char& other) const
@@ -164,126 +181,50 @@ public:
 public:
     CodePoint GetCodePoint() const
     {
-        CodePoint codePoint;
-        const auto lead = static_cast<unsigned char>(data_[0]);
-
-        if ((lead & 0x80) == 0)
-        {
-            codePoint = lead;
-        }
-        else if ((lead & 0xE0) == 0xC0)
-        {
-            codePoint = (lead & 0x1F) << 6;
-            codePoint |= (static_cast<unsigned char>(data_[1]) & 0x3F);
-        }
-        else if ((lead & 0xF0) == 0xE0)
-        {
-            codePoint = (lead & 0x0F) << 12;
-            codePoint |= (static_cast<unsigned char>(data_[1]) & 0x3F) << 6;
-            codePoint |= (static_cast<unsigned char>(data_[2]) & 0x3F);
-        }
-        else if ((lead & 0xF8) == 0xF0)
-        {
-            codePoint = (lead & 0x07) << 18;
-            codePoint |= (static_cast<unsigned char>(data_[1]) & 0x3F) << 12;
-            codePoint |= (static_cast<unsigned char>(data_[2]) & 0x3F) << 6;
-            codePoint |= (static_cast<unsigned char>(data_[3]) & 0x3F);
-        }
-        else
-        {
-            codePoint = 0;
-        }
-        return codePoint;
+        return size_ == 0 ? 0 : __Detail::DecodeUtf8(data_);
     }
 
 private:
-    static DataType FromCodePoint(const CodePoint codePoint)
+    void AssignByte(const char byte)
     {
-        if (codePoint == 0x00)
-        {
-            return {};
-        }
-        const SizeType length = CalculateLength(codePoint);
-
-        if (length == 1)
-        {
-            return DataType{static_cast<char>(codePoint)};
-        }
-        std::ostringstream oss;
-
-        if (length == 2)
-        {
-            oss << static_cast<unsigned char>(0xC0 | (codePoint >> 6));
-            oss << static_cast<unsigned char>(0x80 | (codePoint & 0x3F));
-            return oss.str();
-        }
-        if (length == 3)
+        if (static_cast<Byte>(byte) >= 0x80)
         {
-            oss << static_cast<unsigned char>(0xE0 | (codePoint >> 12));
-            oss << static_cast<unsigned char>(0x80 | ((codePoint >> 6) & 0x3F));
-            oss << static_cast<unsigned char>(0x80 | (codePoint & 0x3F));
-            return oss.str();
+            throw std::invalid_argument("Invalid UTF-8 character");
         }
-        oss << static_cast<unsigned char>(0xF0 | (codePoint >> 18));
-        oss << static_cast<unsigned char>(0x80 | ((codePoint >> 12) & 0x3F));
-        oss << static_cast<unsigned char>(0x80 | ((codePoint >> 6) & 0x3F));
-        oss << static_cast<unsigned char>(0x80 | (codePoint & 0x3F));
-        return oss.str();
+        Assign(&byte, 1);
     }
 
-    static SizeType CalculateLength(const CodePoint codePoint)
+    void Assign(const char* bytes, const SizeType count)
     {
-        if (codePoint < 0x80)
-        {
-            return 1;
-        }
-        if (codePoint < 0x800)
-        {
-            return 2;
-        }
-        if (codePoint < 0x10000)
+        if (count != 0)
         {
-            return 3;
+            std::memcpy(data_, bytes, count);
         }
-        return 4;
+        data_[count] = '\0';
+        size_ = static_cast<UInt8>(count);
     }
 
-private:
-    static bool IsValidUtf8Char(const std::string& str)
+    int Compare(const Char& other) const
     {
-        if (str.empty() || str.size() > 4)
-        {
-            return false;
-        }
-        const auto first = static_cast<unsigned char>(str[0]);
+        const int result = std::memcmp(data_, other.data_, size_ < other.size_ ? size_ : other.size_);
 
-        if ((first & 0x80) == 0)
+        if (result != 0)
         {
-            return str.size() == 1;
+            return result;
         }
-        if ((first & 0xE0) == 0xC0)
-        {
-            return str.size() == 2 && IsContinuationByte(str[1]);
-        }
-        if ((first & 0xF0) == 0xE0)
-        {
-            return str.size() == 3 && IsContinuationByte(str[1]) && IsContinuationByte(str[2]);
-        }
-        if ((first & 0xF8) == 0xF0)
-        {
-            return str.size() == 4 && IsContinuationByte(str[1]) && IsContinuationByte(str[2]) &&
-                   IsContinuationByte(str[3]);
-        }
-        return false;
+        return static_cast<int>(size_) - static_cast<int>(other.size_);
     }
 
-    static bool IsContinuationByte(const char c)
+private:
+    // The same well-formedness rules as String validation: no overlong forms or surrogates
+    static bool IsValidUtf8Char(const char* bytes, const SizeType count)
     {
-        return (static_cast<unsigned char>(c) & 0xC0) == 0x80;
+        return count != 0 && count <= MaxSize && __Detail::Utf8ValidSequenceLength(bytes, count) == count;
     }
 
 private:
-    DataType data_;
+    char data_[MaxSize + 1]{};
+    UInt8 size_{0};
 };
 
 __CAITLYN_GLOBAL_NAMESPACE_END
@@ -233,7 +233,7 @@ public:
         {
             Open();
         }
-        file_ << String::Format(str, std::forward<Args>(args)...);
+        FormatTo(file_, str, args...);
         file_.flush();
     }
 
@@ -297,7 +297,8 @@ public:
         {
             Open();
         }
-        file_ << String::Format(str, std::forward<Args>(args)...) << Def::LineFeed;
+        FormatTo(file_, str, args...);
+        file_ << Def::LineFeed;
         file_.flush();
     }
 
@@ -367,7 +368,7 @@ public:
             Open();
         }
         file_.seekp(0, std::ios::end);
-        file_ << String::Format(str, std::forward<Args>(args)...);
+        FormatTo(file_, str, args...);
         file_.flush();
     }
 
@@ -437,7 +438,8 @@ public:
             Open();
         }
         file_.seekp(0, std::ios::end);
-        file_ << String::Format(str, std::forward<Args>(args)...) << Def::LineFeed;
+        FormatTo(file_, str, args...);
+        file_ << Def::LineFeed;
         file_.flush();
     }
 
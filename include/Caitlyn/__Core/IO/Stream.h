@@ -88,7 +88,8 @@ public:
     template <typename... Args>
     static void Write(const String& str, Args&&... args)
     {
-        std::cout << String::Format(str, std::forward<Args>(args)...) << std::flush;
+        FormatTo(std::cout, str, args...);
+        std::cout << std::flush;
     }
 
     static void WriteLine()
@@ -122,7 +123,8 @@ public:
     template <typename... Args>
     static void WriteLine(const String& str, Args&&... args)
     {
-        std::cout << String::Format(str, std::forward<Args>(args)...) << Def::LineFeed << std::flush;
+        FormatTo(std::cout, str, args...);
+        std::cout << Def::LineFeed << std::flush;
     }
 };
 
@@ -155,7 +157,8 @@ public:
     template <typename... Args>
     static void Write(const String& str, Args&&... args)
     {
-        std::cerr << String::Format(str, std::forward<Args>(args)...) << std::flush;
+        FormatTo(std::cerr, str, args...);
+        std::cerr << std::flush;
     }
 
     static void WriteLine()
@@ -189,7 +192,8 @@ public:
     template <typename... Args>
     static void WriteLine(const String& str, Args&&... args)
     {
-        std::cerr << String::Format(str, std::forward<Args>(args)...) << Def::LineFeed << std::flush;
+        FormatTo(std::cerr, str, args...);
+        std::cerr << Def::LineFeed << std::flush;
     }
 };
 
@@ -222,7 +226,8 @@ public:
     template <typename... Args>
     static void Write(const String& str, Args&&... args)
     {
-        std::clog << String::Format(str, std::forward<Args>(args)...) << std::flush;
+        FormatTo(std::clog, str, args...);
+        std::clog << std::flush;
     }
 
     static void WriteLine()
@@ -256,7 +261,8 @@ public:
     template <typename... Args>
     static void WriteLine(const String& str, Args&&... args)
     {
-        std::clog << String::Format(str, std::forward<Args>(args)...) << Def::LineFeed << std::flush;
+        FormatTo(std::clog, str, args...);
+        std::clog << Def::LineFeed << std::flush;
     }
 };
 
@@ -24,7 +24,16 @@
 
 #include "Caitlyn/__Core/Char.h"
 #include "Caitlyn/__Core/String/Algorithms.h"
+#include "Caitlyn/__Core/String/Format.h"
+#include "Caitlyn/__Core/String/FormatString.h"
+#include "Caitlyn/__Core/String/Hex.h"
+#include "Caitlyn/__Core/String/IgnoreCase.h"
+#include "Caitlyn/__Core/String/ImmutableString.h"
+#include "Caitlyn/__Core/String/Rope.h"
+#include "Caitlyn/__Core/String/Split.h"
 #include "Caitlyn/__Core/String/StringBuilder.h"
+#include "Caitlyn/__Core/String/StringPool.h"
+#include "Caitlyn/__Core/String/StringView.h"
 #include "Caitlyn/__Core/String/Defs.h"
 #include "Caitlyn/__Core/String/String.h"
 #include "Caitlyn/__Core/String/Utility.h"
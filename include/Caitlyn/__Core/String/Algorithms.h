@@ -19,5 +19,8 @@
 #define CAITLYN_CORE_STRING_ALGORITHMS_H_
 
 #include "Caitlyn/__Core/String/Algorithms/Kmp.h"
+#include "Caitlyn/__Core/String/Algorithms/MultiMatcher.h"
+#include "Caitlyn/__Core/String/Algorithms/Parallel.h"
+#include "Caitlyn/__Core/String/Algorithms/Search.h"
 
 #endif // CAITLYN_CORE_STRING_ALGORITHMS_H_
@@ -18,51 +18,169 @@
 #ifndef CAITLYN_CORE_STRING_ALGORITHMS_KMP_H_
 #define CAITLYN_CORE_STRING_ALGORITHMS_KMP_H_
 
+#include <cstring>
 #include <string>
 #include <vector>
 
 #include "Caitlyn/__Base.h"
 
 __CAITLYN_GLOBAL_NAMESPACE_BEGIN
-__CAITLYN_DETAIL_NAMESPACE_BEGIN
 
-inline std::vector<size_t> get_kmp_failure_vec(const std::string& pattern)
+// Knuth-Morris-Pratt search that keeps its state between chunks of input, so a pattern is found
+// in a file or a network stream without joining the pieces. Offsets count bytes from the
+// beginning of the input since the last reset.
+class KmpMatcher
 {
-    const size_t pattern_size = pattern.size();
-    auto failure = std::vector<size_t>(pattern_size + 1);
-    failure[0] = -1;
-
-    for (size_t i = 0, j = failure[0]; i < pattern_size; ++i)
+public:
+    KmpMatcher(const char* pattern, const SizeType size) : pattern_(pattern, size), failure_(size)
     {
-        while (j != std::string::npos && pattern[j] != pattern[i])
+        // Length of the longest proper prefix that is also a suffix of the first i + 1 bytes
+        for (SizeType i = 1, border = 0; i < size; ++i)
         {
-            j = failure[j];
+            while (border > 0 && pattern_[i] != pattern_[border])
+            {
+                border = failure_[border - 1];
+            }
+            if (pattern_[i] == pattern_[border])
+            {
+                ++border;
+            }
+            failure_[i] = border;
         }
-        failure[i + 1] = ++j;
     }
-    return failure;
-}
 
-__CAITLYN_DETAIL_NAMESPACE_END
+    explicit KmpMatcher(const std::string& pattern) : KmpMatcher(pattern.data(), pattern.size())
+    {
+    }
 
-inline bool kmp(const std::string& pattern, const std::string& text)
-{
-    const size_t text_size = text.size();
-    const size_t pattern_size = pattern.size();
-    const auto failure = __Detail::get_kmp_failure_vec(pattern);
+public:
+    SizeType PatternSize() const
+    {
+        return pattern_.size();
+    }
+
+    // Bytes fed since the last reset
+    SizeType Consumed() const
+    {
+        return consumed_;
+    }
 
-    for (size_t i = 0, j = 0; i < text_size; ++i)
+    void Reset()
     {
-        while (j != std::string::npos && pattern[j] != text[i])
+        consumed_ = 0;
+        matched_ = 0;
+    }
+
+    // Continues the search with the next chunk and calls the callback with the offset of every
+    // occurrence that ends in it, overlapping ones included. An empty pattern never matches.
+    template <typename Callback>
+    void Feed(const char* data, const SizeType size, Callback&& callback)
+    {
+        Run(data, size, consumed_, matched_, [&callback](const SizeType offset) -> bool {
+            callback(offset);
+            return true;
+        });
+        consumed_ += size;
+    }
+
+    std::vector<SizeType> Feed(const char* data, const SizeType size)
+    {
+        std::vector<SizeType> offsets;
+        Feed(data, size, [&offsets](const SizeType offset) { offsets.push_back(offset); });
+        return offsets;
+    }
+
+    std::vector<SizeType> Feed(const std::string& chunk)
+    {
+        return Feed(chunk.data(), chunk.size());
+    }
+
+    // Searches a complete text, the stream state is left untouched. NPosition if there is no match.
+    SizeType Find(const char* data, const SizeType size) const
+    {
+        SizeType found = NPosition;
+        SizeType matched = 0;
+        Run(data, size, 0, matched, [&found](const SizeType offset) -> bool {
+            found = offset;
+            return false;
+        });
+        return found;
+    }
+
+    std::vector<SizeType> FindAll(const char* data, const SizeType size) const
+    {
+        std::vector<SizeType> offsets;
+        SizeType matched = 0;
+        Run(data, size, 0, matched, [&offsets](const SizeType offset) -> bool {
+            offsets.push_back(offset);
+            return true;
+        });
+        return offsets;
+    }
+
+    std::vector<SizeType> FindAll(const std::string& text) const
+    {
+        return FindAll(text.data(), text.size());
+    }
+
+private:
+    // Matches the bytes from the given number of matched pattern bytes, the handler returns false to stop
+    template <typename Handler>
+    void Run(const char* data, const SizeType size, const SizeType base, SizeType& matched, Handler&& handler) const
+    {
+        const char* pattern = pattern_.data();
+        const SizeType pattern_size = pattern_.size();
+
+        if (pattern_size == 0)
         {
-            j = failure[j];
+            return;
         }
-        if (++j == pattern_size)
+        for (SizeType i = 0; i < size; ++i)
         {
-            return true;
+            // Nothing matched yet, jump to the next byte that can start a match
+            if (matched == 0)
+            {
+                const auto next = static_cast<const char*>(std::memchr(data + i, pattern[0], size - i));
+
+                if (next == nullptr)
+                {
+                    return;
+                }
+                i = static_cast<SizeType>(next - data);
+            }
+            while (matched > 0 && data[i] != pattern[matched])
+            {
+                matched = failure_[matched - 1];
+            }
+            if (data[i] == pattern[matched] && ++matched == pattern_size)
+            {
+                matched = failure_[pattern_size - 1];
+
+                if (!handler(base + i + 1 - pattern_size))
+                {
+                    return;
+                }
+            }
         }
     }
-    return {};
+
+public:
+    static constexpr auto NPosition{static_cast<SizeType>(-1)};
+
+private:
+    std::string pattern_;
+    std::vector<SizeType> failure_;
+    SizeType consumed_ = 0;
+    SizeType matched_ = 0;
+};
+
+inline bool kmp(const std::string& pattern, const std::string& text)
+{
+    if (pattern.empty())
+    {
+        return !text.empty();
+    }
+    return KmpMatcher{pattern}.Find(text.data(), text.size()) != KmpMatcher::NPosition;
 }
 
 __CAITLYN_GLOBAL_NAMESPACE_END
@@ -0,0 +1,427 @@
+/**
+ * This file is part of the Caitlyn library
+ * Copyright (C) 2024 Alexander Szawrowski
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CAITLYN_CORE_STRING_ALGORITHMS_MULTI_MATCHER_H_
+#define CAITLYN_CORE_STRING_ALGORITHMS_MULTI_MATCHER_H_
+
+#include <algorithm>
+#include <initializer_list>
+#include <vector>
+
+#include "Caitlyn/__Base.h"
+#include "Caitlyn/__Core/Char/Utility.h"
+#include "Caitlyn/__Core/String/String.h"
+#include "Caitlyn/__Core/String/StringView.h"
+#include "Caitlyn/__Core/String/Utf8.h"
+
+__CAITLYN_GLOBAL_NAMESPACE_BEGIN
+__CAITLYN_DETAIL_NAMESPACE_BEGIN
+
+constexpr UInt32 NoState = static_cast<UInt32>(-1);
+constexpr UInt32 RootState = 0;
+// Set in the base of the states where patterns end, so the scan checks the links only there
+constexpr UInt32 MatchFlag = 0x80000000;
+
+__CAITLYN_DETAIL_NAMESPACE_END
+
+enum class CaseMode
+{
+    Sensitive,
+    Insensitive
+};
+
+// Occurrence of a pattern; the position and length count code points, the offset and size count bytes
+struct MultiMatch
+{
+    SizeType pattern;
+    SizeType position;
+    SizeType length;
+    SizeType offset;
+    SizeType size;
+};
+
+// Aho-Corasick automaton over the UTF-8 bytes of the patterns. The trie is stored as a double array,
+// the transition on a byte from a state is base + byte + 1 if the check entry there names the state.
+// All matches of all patterns, overlapping ones included, are reported in one pass over the text.
+class MultiMatcher
+{
+public:
+    MultiMatcher(const std::vector<String>& patterns, const CaseMode mode = CaseMode::Sensitive) : mode_{mode}
+    {
+        Build(patterns.begin(), patterns.end());
+    }
+
+    MultiMatcher(const std::initializer_list<StringView> patterns, const CaseMode mode = CaseMode::Sensitive)
+        : mode_{mode}
+    {
+        Build(patterns.begin(), patterns.end());
+    }
+
+public:
+    SizeType Size() const
+    {
+        return lengths_.size();
+    }
+
+    // Number of states in the double array, free entries included
+    SizeType StateCapacity() const
+    {
+        return units_.size();
+    }
+
+    // Calls the callback with every match in the order of the match ends
+    template <typename Callback>
+    void Scan(const StringView& text, Callback&& callback) const
+    {
+        Run(text, [&callback](const MultiMatch& match) -> bool {
+            callback(match);
+            return true;
+        });
+    }
+
+    std::vector<MultiMatch> FindAll(const StringView& text) const
+    {
+        std::vector<MultiMatch> matches;
+        Scan(text, [&matches](const MultiMatch& match) { matches.push_back(match); });
+        return matches;
+    }
+
+    bool ContainsAny(const StringView& text) const
+    {
+        bool found = false;
+        Run(text, [&found](const MultiMatch&) -> bool {
+            found = true;
+            return false;
+        });
+        return found;
+    }
+
+private:
+    struct Unit
+    {
+        UInt32 base;
+        UInt32 check;
+    };
+
+    struct Links
+    {
+        UInt32 fail;
+        // First pattern ending at the state and the closest state on the fail chain that ends patterns
+        UInt32 output;
+        UInt32 dictionary;
+    };
+
+    struct TrieNode
+    {
+        std::vector<std::pair<Byte, UInt32>> children;
+        UInt32 output;
+    };
+
+    template <typename It>
+    void Build(It first, const It last)
+    {
+        std::vector<TrieNode> trie(1, TrieNode{{}, __Detail::NoState});
+        std::vector<char> folded;
+
+        for (; first != last; ++first)
+        {
+            const StringView pattern(*first);
+            const auto index = static_cast<UInt32>(lengths_.size());
+            lengths_.push_back(pattern.Length());
+            sizes_.push_back(pattern.ByteCount());
+            next_output_.push_back(__Detail::NoState);
+            max_length_ = std::max(max_length_, pattern.Length());
+
+            // Empty patterns never match
+            if (pattern.IsEmpty())
+            {
+                continue;
+            }
+            Fold(pattern, folded);
+            UInt32 node = __Detail::RootState;
+
+            for (const char byte : folded)
+            {
+                auto& children = trie[node].children;
+                const auto found =
+                    std::find_if(children.begin(), children.end(),
+                                 [byte](const std::pair<Byte, UInt32>& child) { return child.first == Byte(byte); });
+
+                if (found != children.end())
+                {
+                    node = found->second;
+                    continue;
+                }
+                const auto child = static_cast<UInt32>(trie.size());
+                children.emplace_back(static_cast<Byte>(byte), child);
+                trie.push_back(TrieNode{{}, __Detail::NoState});
+                node = child;
+            }
+            // Equal patterns are chained behind the first one
+            UInt32* tail = &trie[node].output;
+
+            while (*tail != __Detail::NoState)
+            {
+                tail = &next_output_[*tail];
+            }
+            *tail = index;
+        }
+        Place(trie);
+    }
+
+    // Lays the trie out in the double array in breadth-first order and links every state
+    // to its longest proper suffix that is also a state
+    void Place(std::vector<TrieNode>& trie)
+    {
+        units_.assign(257, Unit{0, __Detail::NoState});
+        links_.assign(257, Links{__Detail::RootState, __Detail::NoState, __Detail::NoState});
+        units_[__Detail::RootState].check = __Detail::RootState;
+        links_[__Detail::RootState].output = trie[__Detail::RootState].output;
+
+        std::vector<std::pair<UInt32, UInt32>> queue{{__Detail::RootState, __Detail::RootState}};
+        SizeType first_free = 1;
+
+        for (SizeType head = 0; head < queue.size(); ++head)
+        {
+            const UInt32 node = queue[head].first;
+            const UInt32 state = queue[head].second;
+            auto& children = trie[node].children;
+
+            if (children.empty())
+            {
+                continue;
+            }
+            std::sort(children.begin(), children.end());
+
+            while (first_free < units_.size() && units_[first_free].check != __Detail::NoState)
+            {
+                ++first_free;
+            }
+            const UInt32 base = FindBase(children, first_free);
+            units_[state].base = base;
+
+            for (const auto& child : children)
+            {
+                units_[base + child.first + 1].check = state;
+            }
+            for (const auto& child : children)
+            {
+                const UInt32 target = base + child.first + 1;
+                UInt32 fail = __Detail::RootState;
+
+                if (state != __Detail::RootState)
+                {
+                    for (fail = links_[state].fail;; fail = links_[fail].fail)
+                    {
+                        const UInt32 next = Transition(fail, child.first);
+
+                        if (next != __Detail::NoState)
+                        {
+                            fail = next;
+                            break;
+                        }
+                        if (fail == __Detail::RootState)
+                        {
+                            break;
+                        }
+                    }
+                }
+                Links& links = links_[target];
+                links.fail = fail;
+                links.output = trie[child.second].output;
+                links.dictionary = links_[fail].output != __Detail::NoState ? fail : links_[fail].dictionary;
+                queue.emplace_back(child.second, target);
+            }
+        }
+        for (const auto& entry : queue)
+        {
+            const Links& links = links_[entry.second];
+
+            if (links.output != __Detail::NoState || links.dictionary != __Detail::NoState)
+            {
+                units_[entry.second].base |= __Detail::MatchFlag;
+            }
+        }
+    }
+
+    UInt32 FindBase(const std::vector<std::pair<Byte, UInt32>>& children, const SizeType first_free)
+    {
+        const SizeType lowest = children.front().first + 1;
+        SizeType base = first_free > lowest ? first_free - lowest : 0;
+
+        while (true)
+        {
+            if (units_.size() < base + 257)
+            {
+                units_.resize(base + 257, Unit{0, __Detail::NoState});
+                links_.resize(base + 257, Links{__Detail::RootState, __Detail::NoState, __Detail::NoState});
+            }
+            bool free = true;
+
+            for (const auto& child : children)
+            {
+                if (units_[base + child.first + 1].check != __Detail::NoState)
+                {
+                    free = false;
+                    break;
+                }
+            }
+            if (free)
+            {
+                return static_cast<UInt32>(base);
+            }
+            ++base;
+        }
+    }
+
+    UInt32 Transition(const UInt32 state, const Byte byte) const
+    {
+        const UInt32 next = (units_[state].base & ~__Detail::MatchFlag) + byte + 1;
+        return units_[next].check == state ? next : __Detail::NoState;
+    }
+
+    // Follows the fail links until the byte has a transition, the root absorbs the rest
+    UInt32 Step(UInt32 state, const Byte byte) const
+    {
+        while (true)
+        {
+            const UInt32 next = Transition(state, byte);
+
+            if (next != __Detail::NoState)
+            {
+                return next;
+            }
+            if (state == __Detail::RootState)
+            {
+                return __Detail::RootState;
+            }
+            state = links_[state].fail;
+        }
+    }
+
+    void Fold(const StringView& pattern, std::vector<char>& folded) const
+    {
+        folded.assign(pattern.data(), pattern.data() + pattern.ByteCount());
+
+        if (mode_ == CaseMode::Sensitive)
+        {
+            return;
+        }
+        folded.clear();
+        const char* data = pattern.data();
+        char buffer[4];
+
+        for (SizeType offset = 0; offset < pattern.ByteCount(); offset = __Detail::Utf8NextOffset(data, offset))
+        {
+            const SizeType size = __Detail::EncodeUtf8(FoldCase(__Detail::DecodeUtf8(data + offset)), buffer);
+            folded.insert(folded.end(), buffer, buffer + size);
+        }
+    }
+
+    // Reports the patterns ending in the state, the end is the byte offset and the code point index
+    // just past the match; the handler returns false to stop the scan
+    template <typename Handler>
+    bool Report(const UInt32 state, const SizeType end, const SizeType end_index, const SizeType* starts,
+                Handler& handler) const
+    {
+        UInt32 current = links_[state].output != __Detail::NoState ? state : links_[state].dictionary;
+
+        for (; current != __Detail::NoState; current = links_[current].dictionary)
+        {
+            for (UInt32 pattern = links_[current].output; pattern != __Detail::NoState; pattern = next_output_[pattern])
+            {
+                const SizeType position = end_index - lengths_[pattern];
+                const SizeType offset = starts != nullptr ? starts[position % max_length_] : end - sizes_[pattern];
+
+                if (!handler(MultiMatch{pattern, position, lengths_[pattern], offset, end - offset}))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    template <typename Handler>
+    void Run(const StringView& text, Handler&& handler) const
+    {
+        const char* data = text.data();
+        const SizeType size = text.ByteCount();
+        UInt32 state = __Detail::RootState;
+        SizeType index = 0;
+
+        if (mode_ == CaseMode::Sensitive)
+        {
+            for (SizeType i = 0; i < size; ++i)
+            {
+                index += __Detail::IsUtf8Continuation(data[i]) ? 0 : 1;
+                state = Step(state, static_cast<Byte>(data[i]));
+
+                if ((units_[state].base & __Detail::MatchFlag) != 0 &&
+                    !Report(state, i + 1, index, nullptr, handler))
+                {
+                    return;
+                }
+            }
+            return;
+        }
+        // Folded code points may change their encoded size, the byte offsets of the recent code points
+        // give the start of a match in the original text
+        std::vector<SizeType> starts(std::max<SizeType>(max_length_, 1));
+        char buffer[4];
+
+        for (SizeType offset = 0; offset < size; ++index)
+        {
+            starts[index % starts.size()] = offset;
+            const auto lead = static_cast<Byte>(data[offset]);
+            SizeType count = 1;
+
+            if (lead < 0x80)
+            {
+                buffer[0] = static_cast<char>(lead >= 'A' && lead <= 'Z' ? lead + ('a' - 'A') : lead);
+                ++offset;
+            }
+            else
+            {
+                count = __Detail::EncodeUtf8(FoldCase(__Detail::DecodeUtf8(data + offset)), buffer);
+                offset = __Detail::Utf8NextOffset(data, offset);
+            }
+            for (SizeType i = 0; i < count; ++i)
+            {
+                state = Step(state, static_cast<Byte>(buffer[i]));
+            }
+            if ((units_[state].base & __Detail::MatchFlag) != 0 &&
+                !Report(state, offset, index + 1, starts.data(), handler))
+            {
+                return;
+            }
+        }
+    }
+
+private:
+    CaseMode mode_;
+    std::vector<Unit> units_;
+    std::vector<Links> links_;
+    std::vector<SizeType> lengths_;
+    std::vector<SizeType> sizes_;
+    std::vector<UInt32> next_output_;
+    SizeType max_length_ = 0;
+};
+
+__CAITLYN_GLOBAL_NAMESPACE_END
+
+#endif // CAITLYN_CORE_STRING_ALGORITHMS_MULTI_MATCHER_H_
@@ -0,0 +1,250 @@
+/**
+ * This file is part of the Caitlyn library
+ * Copyright (C) 2024 Alexander Szawrowski
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CAITLYN_CORE_STRING_ALGORITHMS_PARALLEL_H_
+#define CAITLYN_CORE_STRING_ALGORITHMS_PARALLEL_H_
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "Caitlyn/__Base.h"
+#include "Caitlyn/__Core/String/Algorithms/Search.h"
+#include "Caitlyn/__Core/String/StringView.h"
+#include "Caitlyn/__Core/String/Utf8.h"
+
+__CAITLYN_GLOBAL_NAMESPACE_BEGIN
+
+__CAITLYN_DETAIL_NAMESPACE_BEGIN
+
+// Smaller chunks are not worth a thread
+constexpr SizeType ParallelChunkSize = 256 * 1024;
+
+// ParallelFind workers look for an earlier match of another worker after every block
+constexpr SizeType ParallelBlockSize = 1024 * 1024;
+
+// Chunk bounds at code point starts, from 0 to the size
+inline std::vector<SizeType> ParallelChunks(const char* data, const SizeType size, SizeType threads)
+{
+    if (threads == 0)
+    {
+        threads = std::max<SizeType>(1, std::thread::hardware_concurrency());
+    }
+    const SizeType count = std::max<SizeType>(1, std::min<SizeType>(threads, size / ParallelChunkSize));
+    std::vector<SizeType> bounds(1, 0);
+
+    for (SizeType i = 1; i < count; ++i)
+    {
+        SizeType bound = size / count * i;
+
+        while (bound < size && IsUtf8Continuation(data[bound]))
+        {
+            ++bound;
+        }
+        if (bound > bounds.back())
+        {
+            bounds.push_back(bound);
+        }
+    }
+    bounds.push_back(size);
+    return bounds;
+}
+
+// Calls the task with the index and bounds of every chunk, the first chunk runs on the calling thread
+template <typename Task>
+void RunParallelChunks(const std::vector<SizeType>& bounds, const Task& task)
+{
+    std::vector<std::future<void>> workers;
+
+    for (SizeType i = 1; i + 1 < bounds.size(); ++i)
+    {
+        workers.push_back(std::async(std::launch::async, [&task, &bounds, i] { task(i, bounds[i], bounds[i + 1]); }));
+    }
+    task(0, bounds[0], bounds[1]);
+
+    for (auto& worker : workers)
+    {
+        worker.get();
+    }
+}
+
+inline SizeType ParallelCountCodePoints(const char* data, const SizeType size, const SizeType threads)
+{
+    const auto bounds = ParallelChunks(data, size, threads);
+    std::vector<SizeType> counts(bounds.size() - 1);
+
+    RunParallelChunks(bounds, [data, &counts](const SizeType chunk, const SizeType first, const SizeType last) {
+        counts[chunk] = CountUtf8CodePoints(data + first, last - first);
+    });
+    SizeType count = 0;
+
+    for (const auto value : counts)
+    {
+        count += value;
+    }
+    return count;
+}
+
+// Scans every chunk for the occurrences starting in it, the search reaches pattern size - 1 bytes
+// into the next chunk. The callback gets the chunk index and the number of code points from the
+// chunk start to the occurrence when positions are requested. Returns the chunk lengths in code points.
+template <typename Callback>
+std::vector<SizeType> ParallelScan(const StringView& text, const StringView& pattern,
+                                   const std::vector<SizeType>& bounds, const bool positions, const Callback& callback)
+{
+    const char* data = text.data();
+    const SizeType size = text.ByteCount();
+    const SizeType pattern_size = pattern.ByteCount();
+    const bool ascii = text.IsAscii() || !positions;
+    std::vector<SizeType> lengths(bounds.size() - 1);
+
+    RunParallelChunks(bounds, [&](const SizeType chunk, const SizeType first, const SizeType last) {
+        const SizeType limit = std::min(size, last + pattern_size - 1);
+        SizeType counted = first;
+        SizeType length = 0;
+
+        for (SizeType offset = FindBytes(data, limit, pattern.data(), pattern_size, first); offset != NotFound;
+             offset = FindBytes(data, limit, pattern.data(), pattern_size, offset + 1))
+        {
+            if (!ascii)
+            {
+                length += CountUtf8CodePoints(data + counted, offset - counted);
+                counted = offset;
+            }
+            callback(chunk, ascii ? offset - first : length);
+        }
+        lengths[chunk] = ascii ? last - first : length + CountUtf8CodePoints(data + counted, last - counted);
+    });
+    return lengths;
+}
+
+__CAITLYN_DETAIL_NAMESPACE_END
+
+// Multithreaded counterparts of Find for very large texts. The text is cut into one chunk per
+// thread at code point starts, and an occurrence that crosses a cut belongs to the chunk where it
+// starts. A thread count of 0 uses every hardware thread. Positions count code points.
+
+inline SizeType ParallelFind(const StringView& text, const StringView& pattern, const SizeType threads = 0)
+{
+    const char* data = text.data();
+    const SizeType size = text.ByteCount();
+    const SizeType pattern_size = pattern.ByteCount();
+
+    if (pattern_size == 0)
+    {
+        return 0;
+    }
+    if (pattern_size > size)
+    {
+        return StringView::NPosition;
+    }
+    std::atomic<SizeType> found{__Detail::NotFound};
+
+    __Detail::RunParallelChunks(
+        __Detail::ParallelChunks(data, size, threads), [&](SizeType, const SizeType first, const SizeType last) {
+            for (SizeType block = first; block < last; block += __Detail::ParallelBlockSize)
+            {
+                // An earlier chunk has already found an occurrence before this block
+                SizeType current = found.load(std::memory_order_relaxed);
+
+                if (current < block)
+                {
+                    return;
+                }
+                const SizeType stop = std::min(last, block + __Detail::ParallelBlockSize);
+                const SizeType limit = std::min(size, stop + pattern_size - 1);
+                const SizeType offset = __Detail::FindBytes(data, limit, pattern.data(), pattern_size, block);
+
+                if (offset != __Detail::NotFound)
+                {
+                    while (offset < current && !found.compare_exchange_weak(current, offset))
+                    {
+                    }
+                    return;
+                }
+            }
+        });
+    const SizeType offset = found.load();
+
+    if (offset == __Detail::NotFound)
+    {
+        return StringView::NPosition;
+    }
+    return text.IsAscii() ? offset : __Detail::ParallelCountCodePoints(data, offset, threads);
+}
+
+// Positions of all occurrences in order, overlapping ones included
+inline std::vector<SizeType> ParallelFindAll(const StringView& text, const StringView& pattern,
+                                             const SizeType threads = 0)
+{
+    std::vector<SizeType> positions;
+
+    if (pattern.IsEmpty() || pattern.ByteCount() > text.ByteCount())
+    {
+        return positions;
+    }
+    const auto bounds = __Detail::ParallelChunks(text.data(), text.ByteCount(), threads);
+    std::vector<std::vector<SizeType>> found(bounds.size() - 1);
+    const auto lengths = __Detail::ParallelScan(text, pattern, bounds, true,
+                                                [&found](const SizeType chunk, const SizeType position) {
+                                                    found[chunk].push_back(position);
+                                                });
+    SizeType total = 0;
+
+    for (const auto& chunk : found)
+    {
+        total += chunk.size();
+    }
+    positions.reserve(total);
+    SizeType base = 0;
+
+    for (SizeType chunk = 0; chunk < found.size(); ++chunk)
+    {
+        for (const auto position : found[chunk])
+        {
+            positions.push_back(base + position);
+        }
+        base += lengths[chunk];
+    }
+    return positions;
+}
+
+// Number of occurrences, overlapping ones included
+inline SizeType ParallelCount(const StringView& text, const StringView& pattern, const SizeType threads = 0)
+{
+    if (pattern.IsEmpty() || pattern.ByteCount() > text.ByteCount())
+    {
+        return 0;
+    }
+    const auto bounds = __Detail::ParallelChunks(text.data(), text.ByteCount(), threads);
+    std::vector<SizeType> counts(bounds.size() - 1);
+    __Detail::ParallelScan(text, pattern, bounds, false,
+                           [&counts](const SizeType chunk, SizeType) { ++counts[chunk]; });
+    SizeType count = 0;
+
+    for (const auto value : counts)
+    {
+        count += value;
+    }
+    return count;
+}
+
+__CAITLYN_GLOBAL_NAMESPACE_END
+
+#endif // CAITLYN_CORE_STRING_ALGORITHMS_PARALLEL_H_
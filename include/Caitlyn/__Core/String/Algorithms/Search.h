@@ -0,0 +1,384 @@
+/**
+ * This file is part of the Caitlyn library
+ * Copyright (C) 2024 Alexander Szawrowski
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CAITLYN_CORE_STRING_ALGORITHMS_SEARCH_H_
+#define CAITLYN_CORE_STRING_ALGORITHMS_SEARCH_H_
+
+#include <algorithm>
+#include <cstring>
+
+#include "Caitlyn/__Base.h"
+#include "Caitlyn/__Core/String/Simd.h"
+
+__CAITLYN_GLOBAL_NAMESPACE_BEGIN
+__CAITLYN_DETAIL_NAMESPACE_BEGIN
+
+constexpr auto NotFound = static_cast<SizeType>(-1);
+
+// Patterns up to this size are found by filtering on their first and last bytes,
+// longer ones by the Two-Way algorithm
+constexpr SizeType LongPatternSize = 64;
+
+#if __CAITLYN_HAS_AVX2 || __CAITLYN_HAS_SSE2
+// Marks the positions of a block where the first pattern byte is followed by the last one at the distance
+class BytePairFilter
+{
+public:
+    #if __CAITLYN_HAS_AVX2
+    static constexpr SizeType Width = 32;
+
+    BytePairFilter(const char first, const char last) : first_{_mm256_set1_epi8(first)}, last_{_mm256_set1_epi8(last)}
+    {
+    }
+
+    UInt32 Match(const char* block, const SizeType distance) const
+    {
+        const __m256i head = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+        const __m256i tail = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + distance));
+        return static_cast<UInt32>(_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(head, first_), _mm256_cmpeq_epi8(tail, last_))));
+    }
+
+private:
+    __m256i first_;
+    __m256i last_;
+    #else
+    static constexpr SizeType Width = 16;
+
+    BytePairFilter(const char first, const char last) : first_{_mm_set1_epi8(first)}, last_{_mm_set1_epi8(last)}
+    {
+    }
+
+    UInt32 Match(const char* block, const SizeType distance) const
+    {
+        const __m128i head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+        const __m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + distance));
+        return static_cast<UInt32>(
+            _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(head, first_), _mm_cmpeq_epi8(tail, last_))));
+    }
+
+private:
+    __m128i first_;
+    __m128i last_;
+    #endif
+};
+#endif
+
+// Candidates share the first and the last byte with the pattern, the bytes between are compared after that
+inline SizeType FindShortPattern(const char* text, const SizeType text_size, const char* pattern,
+                                 const SizeType pattern_size, SizeType from)
+{
+    const SizeType last = text_size - pattern_size;
+    const SizeType inner = pattern_size < 2 ? 0 : pattern_size - 2;
+
+#if __CAITLYN_HAS_AVX2 || __CAITLYN_HAS_SSE2
+    const BytePairFilter filter{pattern[0], pattern[pattern_size - 1]};
+
+    for (; from + BytePairFilter::Width <= last + 1; from += BytePairFilter::Width)
+    {
+        for (UInt32 mask = filter.Match(text + from, pattern_size - 1); mask != 0; mask &= mask - 1)
+        {
+            const SizeType candidate = from + CountTrailingZeros(mask);
+
+            if (std::memcmp(text + candidate + 1, pattern + 1, inner) == 0)
+            {
+                return candidate;
+            }
+        }
+    }
+#endif
+    const char first = pattern[0];
+    const char tail = pattern[pattern_size - 1];
+
+    while (from <= last)
+    {
+        const auto found = static_cast<const char*>(std::memchr(text + from, first, last - from + 1));
+
+        if (found == nullptr)
+        {
+            return NotFound;
+        }
+        from = static_cast<SizeType>(found - text);
+
+        if (text[from + pattern_size - 1] == tail && std::memcmp(text + from + 1, pattern + 1, inner) == 0)
+        {
+            return from;
+        }
+        ++from;
+    }
+    return NotFound;
+}
+
+// Two-Way string matching (Crochemore, Perrin) with a last-byte shift table, linear in the text size
+inline SizeType FindLongPattern(const char* text, const SizeType text_size, const char* pattern_bytes,
+                                const SizeType pattern_size, const SizeType from)
+{
+    const auto pattern = reinterpret_cast<const Byte*>(pattern_bytes);
+    const SizeType size = pattern_size;
+    bool present[256] = {};
+    SizeType shift[256];
+
+    for (SizeType i = 0; i < size; ++i)
+    {
+        present[pattern[i]] = true;
+        shift[pattern[i]] = i + 1;
+    }
+
+    // Critical factorization from the maximal suffixes under both byte orders,
+    // the index wraps around from the -1 start value
+    SizeType suffix = 0;
+    SizeType period = 0;
+
+    for (int order = 0; order < 2; ++order)
+    {
+        SizeType i = static_cast<SizeType>(-1);
+        SizeType j = 0;
+        SizeType k = 1;
+        SizeType p = 1;
+
+        while (j + k < size)
+        {
+            const Byte a = pattern[i + k];
+            const Byte b = pattern[j + k];
+
+            if (a == b)
+            {
+                if (k == p)
+                {
+                    j += p;
+                    k = 1;
+                }
+                else
+                {
+                    ++k;
+                }
+            }
+            else if ((order == 0) == (a > b))
+            {
+                j += k;
+                k = 1;
+                p = j - i;
+            }
+            else
+            {
+                i = j++;
+                k = p = 1;
+            }
+        }
+        if (order == 0 || i + 1 > suffix + 1)
+        {
+            suffix = i;
+            period = p;
+        }
+    }
+
+    // A periodic pattern remembers the prefix matched by the previous attempt
+    SizeType memory_reset;
+
+    if (std::memcmp(pattern, pattern + period, suffix + 1) != 0)
+    {
+        memory_reset = 0;
+        period = std::max(suffix, size - suffix - 1) + 1;
+    }
+    else
+    {
+        memory_reset = size - period;
+    }
+    const auto haystack = reinterpret_cast<const Byte*>(text);
+    SizeType position = from;
+    SizeType memory = 0;
+
+    while (text_size - position >= size)
+    {
+        const Byte* window = haystack + position;
+        const Byte tail = window[size - 1];
+
+        if (!present[tail])
+        {
+            position += size;
+            memory = 0;
+            continue;
+        }
+        SizeType k = size - shift[tail];
+
+        if (k != 0)
+        {
+            position += std::max(k, memory);
+            memory = 0;
+            continue;
+        }
+        // Right half of the factorization, then the left half
+        for (k = std::max(suffix + 1, memory); k < size && pattern[k] == window[k]; ++k)
+        {
+        }
+        if (k < size)
+        {
+            position += k - suffix;
+            memory = 0;
+            continue;
+        }
+        for (k = suffix + 1; k > memory && pattern[k - 1] == window[k - 1]; --k)
+        {
+        }
+        if (k <= memory)
+        {
+            return position;
+        }
+        position += period;
+        memory = memory_reset;
+    }
+    return NotFound;
+}
+
+// Byte offset of the first occurrence of the pattern at or after the given offset
+inline SizeType FindBytes(
+    const char* text,
+    const SizeType text_size,
+    const char* pattern,
+    const SizeType pattern_size,
+    const SizeType from = 0)
+{
+    if (from > text_size || pattern_size > text_size - from)
+    {
+        return NotFound;
+    }
+    if (pattern_size == 0)
+    {
+        return from;
+    }
+    if (pattern_size == 1)
+    {
+        const auto found = static_cast<const char*>(std::memchr(text + from, pattern[0], text_size - from));
+        return found != nullptr ? static_cast<SizeType>(found - text) : NotFound;
+    }
+    if (pattern_size <= LongPatternSize)
+    {
+        return FindShortPattern(text, text_size, pattern, pattern_size, from);
+    }
+    return FindLongPattern(text, text_size, pattern, pattern_size, from);
+}
+
+// Same filter as FindShortPattern, walking back from the last candidate
+inline SizeType ReverseFindShortPattern(const char* text, const char* pattern, const SizeType pattern_size,
+                                        SizeType current)
+{
+    const SizeType inner = pattern_size < 2 ? 0 : pattern_size - 2;
+
+#if __CAITLYN_HAS_AVX2 || __CAITLYN_HAS_SSE2
+    const BytePairFilter filter{pattern[0], pattern[pattern_size - 1]};
+
+    // The block holds the candidates current - Width + 1 ... current
+    while (current + 1 >= BytePairFilter::Width)
+    {
+        const SizeType block = current + 1 - BytePairFilter::Width;
+
+        for (UInt32 mask = filter.Match(text + block, pattern_size - 1); mask != 0;)
+        {
+            const UInt32 bit = 31 - CountLeadingZeros(mask);
+
+            if (std::memcmp(text + block + bit + 1, pattern + 1, inner) == 0)
+            {
+                return block + bit;
+            }
+            mask &= ~(static_cast<UInt32>(1) << bit);
+        }
+        if (block == 0)
+        {
+            return NotFound;
+        }
+        current = block - 1;
+    }
+#endif
+    const char first = pattern[0];
+    const char tail = pattern[pattern_size - 1];
+
+    while (true)
+    {
+        if (text[current] == first && text[current + pattern_size - 1] == tail &&
+            std::memcmp(text + current + 1, pattern + 1, inner) == 0)
+        {
+            return current;
+        }
+        if (current == 0)
+        {
+            return NotFound;
+        }
+        --current;
+    }
+}
+
+// Horspool from the right: the window moves back by the distance of its first byte to the
+// closest occurrence of that byte in the pattern after its first position
+inline SizeType ReverseFindLongPattern(const char* text, const char* pattern, const SizeType pattern_size,
+                                       SizeType current)
+{
+    SizeType shift[256];
+    std::fill(shift, shift + 256, pattern_size);
+
+    for (SizeType i = pattern_size - 1; i > 0; --i)
+    {
+        shift[static_cast<Byte>(pattern[i])] = i;
+    }
+    while (true)
+    {
+        if (text[current] == pattern[0] && std::memcmp(text + current + 1, pattern + 1, pattern_size - 1) == 0)
+        {
+            return current;
+        }
+        const SizeType step = shift[static_cast<Byte>(text[current])];
+
+        if (current < step)
+        {
+            return NotFound;
+        }
+        current -= step;
+    }
+}
+
+// Byte offset of the last occurrence of the pattern starting at or before the given offset
+inline SizeType ReverseFindBytes(
+    const char* text,
+    const SizeType text_size,
+    const char* pattern,
+    const SizeType pattern_size,
+    const SizeType from = NotFound)
+{
+    if (pattern_size > text_size)
+    {
+        return NotFound;
+    }
+    SizeType current = text_size - pattern_size;
+
+    if (from < current)
+    {
+        current = from;
+    }
+    if (pattern_size == 0)
+    {
+        return current;
+    }
+    if (pattern_size <= LongPatternSize)
+    {
+        return ReverseFindShortPattern(text, pattern, pattern_size, current);
+    }
+    return ReverseFindLongPattern(text, pattern, pattern_size, current);
+}
+
+__CAITLYN_DETAIL_NAMESPACE_END
+__CAITLYN_GLOBAL_NAMESPACE_END
+
+#endif // CAITLYN_CORE_STRING_ALGORITHMS_SEARCH_H_
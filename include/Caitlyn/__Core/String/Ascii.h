@@ -0,0 +1,118 @@
+/**
+ * This file is part of the Caitlyn library
+ * Copyright (C) 2024 Alexander Szawrowski
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CAITLYN_CORE_STRING_ASCII_H_
+#define CAITLYN_CORE_STRING_ASCII_H_
+
+#include "Caitlyn/__Base.h"
+#include "Caitlyn/__Core/String/Simd.h"
+
+__CAITLYN_GLOBAL_NAMESPACE_BEGIN
+__CAITLYN_DETAIL_NAMESPACE_BEGIN
+
+// Number of leading bytes below 0x80
+inline SizeType AsciiPrefixLength(const char* data, const SizeType size)
+{
+    SizeType offset = 0;
+
+#if __CAITLYN_HAS_AVX2
+    for (; offset + 32 <= size; offset += 32)
+    {
+        const auto mask = static_cast<UInt32>(
+            _mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + offset))));
+
+        if (mask != 0)
+        {
+            return offset + CountTrailingZeros(mask);
+        }
+    }
+#endif
+#if __CAITLYN_HAS_SSE2
+    for (; offset + 16 <= size; offset += 16)
+    {
+        const auto mask = static_cast<UInt32>(
+            _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset))));
+
+        if (mask != 0)
+        {
+            return offset + CountTrailingZeros(mask);
+        }
+    }
+#endif
+    while (offset < size && static_cast<Byte>(data[offset]) < 0x80)
+    {
+        ++offset;
+    }
+    return offset;
+}
+
+// Flips the case bit of the ASCII letters between first and last, other bytes are kept
+inline void ConvertAsciiCase(char* data, const SizeType size, const char first, const char last)
+{
+    SizeType offset = 0;
+
+#if __CAITLYN_HAS_AVX2
+    const __m256i lower_bound = _mm256_set1_epi8(static_cast<char>(first - 1));
+    const __m256i upper_bound = _mm256_set1_epi8(static_cast<char>(last + 1));
+    const __m256i case_bit = _mm256_set1_epi8(0x20);
+
+    for (; offset + 32 <= size; offset += 32)
+    {
+        auto* block = reinterpret_cast<__m256i*>(data + offset);
+        const __m256i input = _mm256_loadu_si256(block);
+        const __m256i letters =
+            _mm256_and_si256(_mm256_cmpgt_epi8(input, lower_bound), _mm256_cmpgt_epi8(upper_bound, input));
+        _mm256_storeu_si256(block, _mm256_xor_si256(input, _mm256_and_si256(letters, case_bit)));
+    }
+#endif
+#if __CAITLYN_HAS_SSE2
+    const __m128i lower_bound_sse = _mm_set1_epi8(static_cast<char>(first - 1));
+    const __m128i upper_bound_sse = _mm_set1_epi8(static_cast<char>(last + 1));
+    const __m128i case_bit_sse = _mm_set1_epi8(0x20);
+
+    for (; offset + 16 <= size; offset += 16)
+    {
+        auto* block = reinterpret_cast<__m128i*>(data + offset);
+        const __m128i input = _mm_loadu_si128(block);
+        const __m128i letters =
+            _mm_and_si128(_mm_cmpgt_epi8(input, lower_bound_sse), _mm_cmpgt_epi8(upper_bound_sse, input));
+        _mm_storeu_si128(block, _mm_xor_si128(input, _mm_and_si128(letters, case_bit_sse)));
+    }
+#endif
+    for (; offset < size; ++offset)
+    {
+        if (data[offset] >= first && data[offset] <= last)
+        {
+            data[offset] = static_cast<char>(data[offset] ^ 0x20);
+        }
+    }
+}
+
+inline void AsciiToUppercase(char* data, const SizeType size)
+{
+    ConvertAsciiCase(data, size, 'a', 'z');
+}
+
+inline void AsciiToLowercase(char* data, const SizeType size)
+{
+    ConvertAsciiCase(data, size, 'A', 'Z');
+}
+
+__CAITLYN_DETAIL_NAMESPACE_END
+__CAITLYN_GLOBAL_NAMESPACE_END
+
+#endif // CAITLYN_CORE_STRING_ASCII_H_
@@ -0,0 +1,130 @@
+/**
+ * This file is part of the Caitlyn library
+ * Copyright (C) 2024 Alexander Szawrowski
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CAITLYN_CORE_STRING_CLASSIFY_H_
+#define CAITLYN_CORE_STRING_CLASSIFY_H_
+
+#include <algorithm>
+
+#include "Caitlyn/__Base.h"
+#include "Caitlyn/__Core/Char/ClassTable.h"
+#include "Caitlyn/__Core/String/Simd.h"
+#include "Caitlyn/__Core/String/Utf8.h"
+
+__CAITLYN_GLOBAL_NAMESPACE_BEGIN
+__CAITLYN_DETAIL_NAMESPACE_BEGIN
+
+#if __CAITLYN_HAS_SSE2
+// Bit mask of the 16 bytes belonging to the classes, all classified bytes are ASCII
+inline UInt32 ClassMask(const __m128i input, const UInt8 classes)
+{
+    __m128i result = _mm_setzero_si128();
+
+    if ((classes & CharClassSpace) != 0)
+    {
+        const __m128i controls = _mm_and_si128(_mm_cmpgt_epi8(input, _mm_set1_epi8('\t' - 1)),
+                                               _mm_cmpgt_epi8(_mm_set1_epi8('\r' + 1), input));
+        result = _mm_or_si128(result, _mm_or_si128(controls, _mm_cmpeq_epi8(input, _mm_set1_epi8(' '))));
+    }
+    if ((classes & CharClassDigit) != 0)
+    {
+        result = _mm_or_si128(result, _mm_and_si128(_mm_cmpgt_epi8(input, _mm_set1_epi8('0' - 1)),
+                                                    _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), input)));
+    }
+    return static_cast<UInt32>(_mm_movemask_epi8(result));
+}
+#endif
+
+inline bool IsClassAt(const char* data, const SizeType offset, const UInt8 classes)
+{
+    const auto byte = static_cast<Byte>(data[offset]);
+
+    if (byte < 0x80)
+    {
+        return (AsciiClassTable()[byte] & classes) != 0;
+    }
+    return (LookupCharClass(DecodeUtf8(data + offset)) & classes) != 0;
+}
+
+// Byte offset of the first code point outside the classes
+inline SizeType SkipClass(const char* data, const SizeType size, const UInt8 classes)
+{
+    SizeType offset = 0;
+
+    while (offset < size)
+    {
+#if __CAITLYN_HAS_SSE2
+        for (; offset + 16 <= size; offset += 16)
+        {
+            const UInt32 mask = ClassMask(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset)), classes);
+
+            if (mask != 0xFFFF)
+            {
+                offset += CountTrailingZeros(~mask);
+                break;
+            }
+        }
+        if (offset == size)
+        {
+            break;
+        }
+#endif
+        if (!IsClassAt(data, offset, classes))
+        {
+            break;
+        }
+        offset = Utf8NextOffset(data, offset);
+    }
+    return offset;
+}
+
+// Number of code points belonging to the classes
+inline SizeType CountClass(const char* data, const SizeType size, const UInt8 classes)
+{
+    SizeType count = 0;
+    SizeType offset = 0;
+
+    while (offset < size)
+    {
+#if __CAITLYN_HAS_SSE2
+        for (; offset + 16 <= size; offset += 16)
+        {
+            const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));
+
+            if (_mm_movemask_epi8(input) != 0)
+            {
+                break;
+            }
+            count += PopCount(ClassMask(input, classes));
+        }
+#endif
+        // A block with non-ASCII bytes is classified code point by code point
+        const SizeType stop = std::min<SizeType>(size, offset + 16);
+
+        while (offset < stop)
+        {
+            count += IsClassAt(data, offset, classes) ? 1 : 0;
+            offset = Utf8NextOffset(data, offset);
+        }
+    }
+    return count;
+}
+
+__CAITLYN_DETAIL_NAMESPACE_END
+__CAITLYN_GLOBAL_NAMESPACE_END
+
+#endif // CAITLYN_CORE_STRING_CLASSIFY_H_
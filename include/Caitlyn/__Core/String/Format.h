@@ -0,0 +1,771 @@
+/**
+ * This file is part of the Caitlyn library
+ * Copyright (C) 2024 Alexander Szawrowski
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CAITLYN_CORE_STRING_FORMAT_H_
+#define CAITLYN_CORE_STRING_FORMAT_H_
+
+#include <algorithm>
+#include <cfloat>
+#include <cstdlib>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+#include "Caitlyn/__Base.h"
+#include "Caitlyn/__Core/Char.h"
+#include "Caitlyn/__Core/String/FormatString.h"
+#include "Caitlyn/__Core/String/NumberFormat.h"
+#include "Caitlyn/__Core/String/StringView.h"
+#include "Caitlyn/__Core/String/Utf8.h"
+#include "Caitlyn/__Core/Traits/Constraints/Primary.h"
+#include "Caitlyn/__Core/Traits/Constraints/String.h"
+#include "Caitlyn/__Core/Traits/Types/Base.h"
+
+__CAITLYN_GLOBAL_NAMESPACE_BEGIN
+
+class String;
+
+// Destination of formatted output. Bytes are written into a window provided by the implementation,
+// Flush is called when the window is full.
+class FormatBuffer
+{
+public:
+    FormatBuffer(const FormatBuffer&) = delete;
+    FormatBuffer& operator=(const FormatBuffer&) = delete;
+    virtual ~FormatBuffer() = default;
+
+public:
+    void Append(const char* bytes, SizeType count)
+    {
+        while (count > capacity_ - size_)
+        {
+            const SizeType part = capacity_ - size_;
+            std::memcpy(data_ + size_, bytes, part);
+            size_ = capacity_;
+            bytes += part;
+            count -= part;
+            Flush(count);
+        }
+        std::memcpy(data_ + size_, bytes, count);
+        size_ += count;
+    }
+
+    void Append(SizeType count, const char byte)
+    {
+        while (count > capacity_ - size_)
+        {
+            const SizeType part = capacity_ - size_;
+            std::memset(data_ + size_, byte, part);
+            size_ = capacity_;
+            count -= part;
+            Flush(count);
+        }
+        std::memset(data_ + size_, byte, count);
+        size_ += count;
+    }
+
+    void Append(SizeType count, const Char& ch)
+    {
+        if (ch.size() == 1)
+        {
+            Append(count, ch.data()[0]);
+            return;
+        }
+        for (; count > 0; --count)
+        {
+            Append(ch.data(), ch.size());
+        }
+    }
+
+protected:
+    FormatBuffer(char* data, const SizeType capacity) : data_{data}, size_{0}, capacity_{capacity}
+    {
+    }
+
+    // Empties or replaces the full window, pending is the number of bytes still to be written
+    virtual void Flush(SizeType pending) = 0;
+
+protected:
+    char* data_;
+    SizeType size_;
+    SizeType capacity_;
+};
+
+// Formats into a caller-supplied array. Output that does not fit is dropped but still counted.
+class FixedFormatBuffer final : public FormatBuffer
+{
+public:
+    FixedFormatBuffer(char* data, const SizeType capacity)
+        : FormatBuffer(data, capacity), begin_{data}, limit_{capacity}, stored_{0}, dropped_{0}, truncated_{false}
+    {
+        if (capacity == 0)
+        {
+            Flush(0);
+        }
+    }
+
+    template <SizeType N>
+    explicit FixedFormatBuffer(char (&data)[N]) : FixedFormatBuffer(data, N)
+    {
+    }
+
+public:
+    const char* data() const
+    {
+        return begin_;
+    }
+
+    // Bytes stored in the array, truncation does not split a UTF-8 sequence
+    SizeType Size() const
+    {
+        return truncated_ ? stored_ : size_;
+    }
+
+    // Bytes of the complete output
+    SizeType TotalSize() const
+    {
+        return truncated_ ? limit_ + dropped_ + size_ : size_;
+    }
+
+    bool IsTruncated() const
+    {
+        return TotalSize() > Size();
+    }
+
+private:
+    void Flush(SizeType) override
+    {
+        if (truncated_)
+        {
+            dropped_ += size_;
+        }
+        else
+        {
+            truncated_ = true;
+            stored_ = limit_;
+            SizeType lead = limit_;
+
+            while (lead > 0 && __Detail::IsUtf8Continuation(begin_[lead - 1]))
+            {
+                --lead;
+            }
+            if (lead > 0 && __Detail::Utf8SequenceLength(begin_[lead - 1]) > limit_ - lead + 1)
+            {
+                stored_ = lead - 1;
+            }
+        }
+        data_ = overflow_;
+        size_ = 0;
+        capacity_ = sizeof(overflow_);
+    }
+
+private:
+    char* begin_;
+    SizeType limit_;
+    SizeType stored_;
+    SizeType dropped_;
+    bool truncated_;
+    char overflow_[64];
+};
+
+__CAITLYN_DETAIL_NAMESPACE_BEGIN
+
+// Counts the output without keeping it
+class CountingFormatBuffer final : public FormatBuffer
+{
+public:
+    CountingFormatBuffer() : FormatBuffer(window_, sizeof(window_)), count_{0}
+    {
+    }
+
+public:
+    SizeType Count() const
+    {
+        return count_ + size_;
+    }
+
+private:
+    void Flush(SizeType) override
+    {
+        count_ += size_;
+        size_ = 0;
+    }
+
+private:
+    char window_[64];
+    SizeType count_;
+};
+
+class StreamFormatBuffer final : public FormatBuffer
+{
+public:
+    explicit StreamFormatBuffer(std::ostream& stream) : FormatBuffer(window_, sizeof(window_)), stream_(stream)
+    {
+    }
+
+public:
+    void Finish()
+    {
+        Flush(0);
+    }
+
+private:
+    void Flush(SizeType) override
+    {
+        stream_.write(window_, static_cast<std::streamsize>(size_));
+        size_ = 0;
+    }
+
+private:
+    std::ostream& stream_;
+    char window_[256];
+};
+
+template <typename OutputIt>
+class IteratorFormatBuffer final : public FormatBuffer
+{
+public:
+    explicit IteratorFormatBuffer(OutputIt out) : FormatBuffer(window_, sizeof(window_)), out_(out)
+    {
+    }
+
+public:
+    OutputIt Finish()
+    {
+        Flush(0);
+        return out_;
+    }
+
+private:
+    void Flush(SizeType) override
+    {
+        out_ = std::copy(window_, window_ + size_, out_);
+        size_ = 0;
+    }
+
+private:
+    OutputIt out_;
+    char window_[256];
+};
+
+template <typename T>
+constexpr Bool IsFormatText()
+{
+    return std::is_convertible<const T&, StringView>::value;
+}
+
+// Types that write themselves: void WriteFormat(FormatBuffer&, const FormatSpecifier*) const
+template <typename, typename = void>
+struct __Has_WriteFormat_Type : FalseType
+{
+};
+
+template <typename T>
+struct __Has_WriteFormat_Type<T, Indicator<decltype(std::declval<const T&>().WriteFormat(
+                                     std::declval<FormatBuffer&>(), std::declval<const FormatSpecifier*>()))>>
+    : TrueType
+{
+};
+
+template <typename T>
+constexpr Bool IsFormatWritable()
+{
+    return __Has_WriteFormat_Type<T>::Value;
+}
+
+// Arguments written as text or as floating-point numbers, which take no representation or grouping
+template <typename T>
+constexpr Bool IsPlainFormatArgument()
+{
+    return !IsInteger<T>() && !IsCharacter<T>() && !IsFormatWritable<T>();
+}
+
+template <typename... Args>
+struct PlainFormatMask
+{
+    static constexpr UInt64 Value = 0;
+};
+
+template <typename T, typename... Args>
+struct PlainFormatMask<T, Args...>
+{
+    static constexpr UInt64 Value = (IsPlainFormatArgument<T>() ? 1 : 0) | PlainFormatMask<Args...>::Value << 1;
+};
+
+template <typename... Args>
+std::integral_constant<UInt64, PlainFormatMask<Args...>::Value> PlainFormatArguments(const char*, const Args&...);
+
+template <typename T>
+constexpr Bool IsFormatIterator()
+{
+    return !std::is_base_of<FormatBuffer, T>::value && !std::is_base_of<std::ostream, T>::value &&
+           !std::is_same<String, T>::value;
+}
+
+// Writes argument values as text and applies the specifier of the replacement field
+struct FormatWriter
+{
+    template <typename T>
+    static void WriteArgument(FormatBuffer& buffer, const void* value, const FormatSpecifier* spec)
+    {
+        Write(buffer, *static_cast<const T*>(value), spec);
+    }
+
+    static void Write(FormatBuffer& buffer, const StringView& value, const FormatSpecifier* spec)
+    {
+        CheckPlain(spec);
+        WriteText(buffer, value.data(), value.ByteCount(), value.Length(), spec);
+    }
+
+    // Mutable String subscripts yield a proxy, which is written as the character it refers to
+    template <typename StringT>
+    static void Write(FormatBuffer& buffer, const __Detail::StringCharReference<StringT>& value,
+                      const FormatSpecifier* spec)
+    {
+        Write(buffer, value.Get(), spec);
+    }
+
+    template <typename T>
+    static Required<IsInteger<T>() || IsCharacter<T>()> Write(FormatBuffer& buffer, const T& value,
+                                                              const FormatSpecifier* spec)
+    {
+        WriteInteger(buffer, value, std::is_signed<T>{}, spec);
+    }
+
+    template <typename T>
+    static Required<IsFloating<T>()> Write(FormatBuffer& buffer, const T& value, const FormatSpecifier* spec)
+    {
+        CheckPlain(spec);
+        WriteFloating(buffer, value, spec);
+    }
+
+    template <typename T>
+    static Required<IsBoolean<T>()> Write(FormatBuffer& buffer, const T& value, const FormatSpecifier* spec)
+    {
+        CheckPlain(spec);
+
+        if (value)
+        {
+            WriteText(buffer, "true", 4, 4, spec);
+        }
+        else
+        {
+            WriteText(buffer, "false", 5, 5, spec);
+        }
+    }
+
+    template <typename T>
+    static Required<IsFormatWritable<T>()> Write(FormatBuffer& buffer, const T& value, const FormatSpecifier* spec)
+    {
+        value.WriteFormat(buffer, spec);
+    }
+
+    template <typename T>
+    static Required<HasToString<T>() && !IsFormatText<T>() && !IsFormatWritable<T>()> Write(
+        FormatBuffer& buffer, const T& value, const FormatSpecifier* spec)
+    {
+        Write(buffer, value.to_string(), spec);
+    }
+
+    template <typename T>
+    static Required<HasStr<T>() && !IsFormatText<T>() && !IsFormatWritable<T>()> Write(
+        FormatBuffer& buffer, const T& value, const FormatSpecifier* spec)
+    {
+        Write(buffer, value.str(), spec);
+    }
+
+    template <typename T>
+    static Required<ConvertibleToString<T>() && !IsFormatText<T>() && !IsFormatWritable<T>()> Write(
+        FormatBuffer& buffer, const T& value, const FormatSpecifier* spec)
+    {
+        Write(buffer, value.ToString(), spec);
+    }
+
+    // Text, booleans and floating-point numbers have no b, o or x representation and no digit grouping
+    static void CheckPlain(const FormatSpecifier* spec)
+    {
+        if (spec != nullptr && (spec->repr != FormatRepresentation::Default || spec->grouping != '\0'))
+        {
+            throw FormatError{FormatCheckMessage(FormatCheck::UnsupportedSpecifier)};
+        }
+    }
+
+    template <typename T>
+    static void WriteInteger(FormatBuffer& buffer, const T value, std::true_type, const FormatSpecifier* spec)
+    {
+        const auto magnitude = static_cast<UInt64>(value);
+        WriteIntegral(buffer, value < 0 ? 0 - magnitude : magnitude, value < 0, spec);
+    }
+
+    template <typename T>
+    static void WriteInteger(FormatBuffer& buffer, const T value, std::false_type, const FormatSpecifier* spec)
+    {
+        WriteIntegral(buffer, static_cast<UInt64>(value), false, spec);
+    }
+
+    static void WriteIntegral(FormatBuffer& buffer, const UInt64 value, const bool negative,
+                              const FormatSpecifier* spec)
+    {
+        // Binary needs 64 digits, the sign goes in front of them
+        char digits[65];
+        char* const end = digits + sizeof(digits);
+        char* begin;
+        const char* prefix = "";
+        SizeType group = 4;
+
+        if (spec == nullptr || spec->repr == FormatRepresentation::Default)
+        {
+            if (spec == nullptr || spec->type == FormatValueType::Floating)
+            {
+                begin = WriteSignedDecimalBackward(end, value, negative);
+                const auto count = static_cast<SizeType>(end - begin);
+                WriteText(buffer, begin, count, count, spec);
+                return;
+            }
+            begin = WriteDecimalBackward(end, value);
+            group = 3;
+        }
+        else if (spec->repr == FormatRepresentation::Binary || spec->repr == FormatRepresentation::BinaryPrefixed)
+        {
+            begin = WriteBinaryBackward(end, value);
+            prefix = spec->uppercase ? "0B" : "0b";
+        }
+        else if (spec->repr == FormatRepresentation::Octal || spec->repr == FormatRepresentation::OctalPrefixed)
+        {
+            begin = WriteOctalBackward(end, value);
+            prefix = value != 0 ? "0" : "";
+        }
+        else
+        {
+            begin = WriteHexBackward(end, value, spec->uppercase);
+            prefix = spec->uppercase ? "0X" : "0x";
+        }
+        if (spec->repr != FormatRepresentation::BinaryPrefixed && spec->repr != FormatRepresentation::OctalPrefixed &&
+            spec->repr != FormatRepresentation::HexPrefixed)
+        {
+            prefix = "";
+        }
+        WriteNumber(buffer, negative, prefix, begin, static_cast<SizeType>(end - begin), group, spec->grouping, *spec);
+    }
+
+    static SizeType GroupSeparators(const SizeType count, const SizeType group, const char separator)
+    {
+        return separator != '\0' && count != 0 ? (count - 1) / group : 0;
+    }
+
+    // Sign, prefix and digits padded to the field width; the 0 flag pads with zeros after the prefix
+    // and the separator splits the digits into groups counted from the right
+    static void WriteNumber(FormatBuffer& buffer, const bool negative, const char* prefix, const char* digits,
+                            const SizeType count, const SizeType group, const char separator,
+                            const FormatSpecifier& spec)
+    {
+        const SizeType head = (negative ? 1 : 0) + std::strlen(prefix);
+        SizeType zeros = 0;
+
+        if (spec.zero)
+        {
+            while (head + count + zeros + GroupSeparators(count + zeros, group, separator) < spec.width)
+            {
+                ++zeros;
+            }
+        }
+        const SizeType total = count + zeros;
+        const SizeType right = WritePadding(buffer, head + total + GroupSeparators(total, group, separator), spec);
+
+        if (negative)
+        {
+            buffer.Append(1, '-');
+        }
+        buffer.Append(prefix, head - (negative ? 1 : 0));
+
+        // Whole runs between separators, the leading zeros are a part of the first runs
+        SizeType position = 0;
+        SizeType run = separator == '\0' ? total : (total - 1) % group + 1;
+
+        while (position < total)
+        {
+            if (position != 0)
+            {
+                buffer.Append(1, separator);
+            }
+            const SizeType run_end = position + run;
+
+            if (position < zeros)
+            {
+                const SizeType padded = std::min(run_end, zeros) - position;
+                buffer.Append(padded, '0');
+                position += padded;
+            }
+            if (position < run_end)
+            {
+                buffer.Append(digits + (position - zeros), run_end - position);
+                position = run_end;
+            }
+            run = group;
+        }
+        buffer.Append(right, spec.fill);
+    }
+
+    // Shortest round-trip text by default, fixed notation when the field has a precision or the f type
+    template <typename T>
+    static void WriteFloating(FormatBuffer& buffer, const T value, const FormatSpecifier* spec)
+    {
+        char digits[48];
+        SizeType count;
+
+        if (spec == nullptr || (spec->type != FormatValueType::Floating && spec->precision < 0))
+        {
+            count = WriteShortest(value, digits);
+        }
+        else
+        {
+            const Int32 precision = spec->precision < 0 ? DefaultPrecision : spec->precision;
+            count = WriteFixed(value, precision, digits);
+
+            if (count == 0)
+            {
+                const std::string text = PrintFloating("%.*f", precision, static_cast<double>(value));
+                WriteSigned(buffer, text.data(), text.size(), spec);
+                return;
+            }
+        }
+        WriteSigned(buffer, digits, count, spec);
+    }
+
+    static void WriteFloating(FormatBuffer& buffer, const long double value, const FormatSpecifier* spec)
+    {
+        // Values that are exact doubles take the double path
+        if (value != value || static_cast<long double>(static_cast<double>(value)) == value)
+        {
+            WriteFloating(buffer, static_cast<double>(value), spec);
+            return;
+        }
+        std::string text;
+
+        if (spec == nullptr || (spec->type != FormatValueType::Floating && spec->precision < 0))
+        {
+            for (Int32 precision = LDBL_DIG; precision <= LDBL_DIG + 3; ++precision)
+            {
+                text = PrintFloating("%.*Lg", precision, value);
+
+                if (std::strtold(text.c_str(), nullptr) == value)
+                {
+                    break;
+                }
+            }
+        }
+        else
+        {
+            text = PrintFloating("%.*Lf", spec->precision < 0 ? DefaultPrecision : spec->precision, value);
+        }
+        WriteSigned(buffer, text.data(), text.size(), spec);
+    }
+
+    // Formatted floating text, the 0 flag puts the zeros between the sign and the digits of finite values
+    static void WriteSigned(FormatBuffer& buffer, const char* text, const SizeType count, const FormatSpecifier* spec)
+    {
+        if (spec == nullptr || !spec->zero || text[count - 1] == 'f' || text[count - 1] == 'n')
+        {
+            WriteAligned(buffer, text, count, count, spec);
+            return;
+        }
+        const bool negative = text[0] == '-';
+        WriteNumber(buffer, negative, "", text + (negative ? 1 : 0), count - (negative ? 1 : 0), 3, '\0', *spec);
+    }
+
+    static void WriteText(FormatBuffer& buffer, const char* bytes, SizeType count, SizeType length,
+                          const FormatSpecifier* spec)
+    {
+        if (spec == nullptr)
+        {
+            buffer.Append(bytes, count);
+            return;
+        }
+        bool point = false;
+        SizeType zeros = 0;
+
+        // With the f type the precision applies to the digits of the text, without rounding
+        if (spec->type == FormatValueType::Floating)
+        {
+            const auto found = static_cast<const char*>(std::memchr(bytes, '.', count));
+
+            if (found != nullptr)
+            {
+                const auto dot = static_cast<SizeType>(found - bytes);
+                SizeType end = dot + 1;
+
+                if (spec->precision > 0)
+                {
+                    const SizeType limit = end + static_cast<SizeType>(spec->precision);
+
+                    while (end < count && end < limit && bytes[end] >= '0' && bytes[end] <= '9')
+                    {
+                        ++end;
+                    }
+                    zeros = limit - end;
+                }
+                length -= CountUtf8CodePoints(bytes + end, count - end);
+                count = end;
+            }
+            else if (spec->precision > 0)
+            {
+                point = true;
+                zeros = static_cast<SizeType>(spec->precision);
+            }
+        }
+        WriteAligned(buffer, bytes, count, length + zeros + (point ? 1 : 0), spec, point, zeros);
+    }
+
+    // Pads the text to the field width, point and zeros are the precision suffix of WriteText
+    static void WriteAligned(FormatBuffer& buffer, const char* bytes, const SizeType count, const SizeType length,
+                             const FormatSpecifier* spec, const bool point = false, const SizeType zeros = 0)
+    {
+        if (spec == nullptr)
+        {
+            buffer.Append(bytes, count);
+            return;
+        }
+        const SizeType right = WritePadding(buffer, length, *spec);
+        buffer.Append(bytes, count);
+
+        if (point)
+        {
+            buffer.Append(1, '.');
+        }
+        buffer.Append(zeros, '0');
+        buffer.Append(right, spec->fill);
+    }
+
+    // Writes the fill in front of a field of the given length and returns the fill count after it
+    static SizeType WritePadding(FormatBuffer& buffer, const SizeType length, const FormatSpecifier& spec)
+    {
+        const SizeType padding = spec.width > length ? spec.width - length : 0;
+        SizeType left = 0;
+
+        if (spec.align == FormatAlignment::Right)
+        {
+            left = padding;
+        }
+        else if (spec.align == FormatAlignment::Center)
+        {
+            left = padding / 2;
+        }
+        buffer.Append(left, spec.fill);
+        return padding - left;
+    }
+
+    static constexpr Int32 DefaultPrecision = 6;
+};
+
+struct FormatArgument
+{
+    const void* value;
+    void (*write)(FormatBuffer&, const void*, const FormatSpecifier*);
+};
+
+template <typename T>
+FormatArgument MakeFormatArgument(const T& value)
+{
+    return FormatArgument{&value, &FormatWriter::WriteArgument<T>};
+}
+
+inline void FormatArguments(FormatBuffer& buffer, const FormatString& format, const FormatArgument* arguments,
+                            const SizeType count)
+{
+    format.Check(count);
+    const char* pattern = format.Pattern();
+
+    for (const auto& segment : format.Segments())
+    {
+        if (segment.argument == FormatSegment::Literal)
+        {
+            buffer.Append(pattern + segment.offset, segment.bytes);
+        }
+        else
+        {
+            const FormatArgument& argument = arguments[FormatString::Argument(segment, count)];
+            argument.write(buffer, argument.value, segment.specified ? &segment.spec : nullptr);
+        }
+    }
+}
+
+// Pattern parameter of the format functions: a parsed FormatString or text that is looked up in the cache
+class FormatPattern
+{
+public:
+    FormatPattern(const FormatString& format) : format_{&format}
+    {
+    }
+
+    template <typename T, typename = Required<IsFormatText<T>()>>
+    FormatPattern(const T& pattern) : format_{nullptr}, pattern_(pattern)
+    {
+    }
+
+public:
+    // Resolved inside the format call, so the cache cannot drop the pattern while it is in use
+    const FormatString& Get() const
+    {
+        return format_ != nullptr ? *format_ : FormatString::Cached(pattern_);
+    }
+
+private:
+    const FormatString* format_;
+    StringView pattern_;
+};
+
+__CAITLYN_DETAIL_NAMESPACE_END
+
+// Formats into the buffer without intermediate strings
+template <typename... Args>
+void FormatTo(FormatBuffer& buffer, const __Detail::FormatPattern& format, const Args&... args)
+{
+    const FormatString::Usage usage;
+    const __Detail::FormatArgument arguments[] = {__Detail::MakeFormatArgument(args)..., {nullptr, nullptr}};
+    __Detail::FormatArguments(buffer, format.Get(), arguments, sizeof...(Args));
+}
+
+template <typename... Args>
+void FormatTo(std::ostream& stream, const __Detail::FormatPattern& format, const Args&... args)
+{
+    __Detail::StreamFormatBuffer buffer{stream};
+    FormatTo(buffer, format, args...);
+    buffer.Finish();
+}
+
+template <typename OutputIt, typename... Args>
+Required<__Detail::IsFormatIterator<OutputIt>(), OutputIt> FormatTo(OutputIt out, const __Detail::FormatPattern& format,
+                                                                    const Args&... args)
+{
+    __Detail::IteratorFormatBuffer<OutputIt> buffer{out};
+    FormatTo(buffer, format, args...);
+    return buffer.Finish();
+}
+
+// Number of bytes the formatted text takes
+template <typename... Args>
+SizeType FormattedSize(const __Detail::FormatPattern& format, const Args&... args)
+{
+    __Detail::CountingFormatBuffer buffer;
+    FormatTo(buffer, format, args...);
+    return buffer.Count();
+}
+
+__CAITLYN_GLOBAL_NAMESPACE_END
+
+#endif // CAITLYN_CORE_STRING_FORMAT_H_
@@ -0,0 +1,622 @@
+/**
+ * This file is part of the Caitlyn library
+ * Copyright (C) 2024 Alexander Szawrowski
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CAITLYN_CORE_STRING_FORMAT_STRING_H_
+#define CAITLYN_CORE_STRING_FORMAT_STRING_H_
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "Caitlyn/__Base.h"
+#include "Caitlyn/__Core/Char.h"
+#include "Caitlyn/__Core/String/Hash.h"
+#include "Caitlyn/__Core/String/StringView.h"
+#include "Caitlyn/__Core/String/Utf8.h"
+
+__CAITLYN_GLOBAL_NAMESPACE_BEGIN
+
+class FormatError final : public std::runtime_error
+{
+public:
+    explicit FormatError(const char* message) : std::runtime_error(message)
+    {
+    }
+};
+
+__CAITLYN_DETAIL_NAMESPACE_BEGIN
+
+enum class FormatAlignment
+{
+    Left,
+    Right,
+    Center,
+};
+
+enum class FormatValueType
+{
+    String,
+    Integral,
+    Floating,
+};
+
+enum class FormatRepresentation
+{
+    Default,
+    Binary,
+    BinaryPrefixed,
+    Octal,
+    OctalPrefixed,
+    Hex,
+    HexPrefixed,
+};
+
+struct FormatSpecifier
+{
+    FormatAlignment align = FormatAlignment::Left;
+    SizeType width = 0;
+    Char fill = Def::Space;
+    FormatRepresentation repr = FormatRepresentation::Default;
+    FormatValueType type = FormatValueType::String;
+    Int32 precision = -1;
+    bool uppercase = false;
+    bool zero = false;
+    char grouping = '\0';
+};
+
+// Literal text of the pattern or a replacement field
+struct FormatSegment
+{
+    static constexpr SizeType Literal = static_cast<SizeType>(-1);
+
+    SizeType offset = 0;
+    SizeType bytes = 0;
+    SizeType length = 0;
+    SizeType argument = Literal;
+    bool automatic = false;
+    bool specified = false;
+    FormatSpecifier spec;
+};
+
+enum class FormatCheck
+{
+    Valid,
+    MismatchedBraces,
+    SingleRightBracket,
+    MissingArgument,
+    IndexOutOfRange,
+    IncorrectSpecifier,
+    UnsupportedSpecifier,
+};
+
+inline const char* FormatCheckMessage(const FormatCheck check)
+{
+    switch (check)
+    {
+        case FormatCheck::MismatchedBraces:
+            return "Mismatched braces in format string";
+        case FormatCheck::SingleRightBracket:
+            return "Single right curly bracket in format string";
+        case FormatCheck::MissingArgument:
+            return "Missing argument index in format string";
+        case FormatCheck::IndexOutOfRange:
+            return "Argument index out of range";
+        case FormatCheck::IncorrectSpecifier:
+            return "Incorrect format specifier";
+        case FormatCheck::UnsupportedSpecifier:
+            return "Format specifier is not supported by the argument type";
+        default:
+            return "";
+    }
+}
+
+// Compile-time check of the braces, argument indices and specifiers. Literal text is skipped in blocks
+// of FormatLiteralBlock bytes, the fields and escaped braces take a recursion step per character.
+// An automatic field takes the next argument, a single argument serves every automatic field.
+// Arguments with their bit set in the plain mask are text or floating-point values, which take neither
+// a b, o or x representation nor digit grouping; arguments past the 64th are not checked for it.
+constexpr FormatCheck CheckFormat(const char* format, SizeType arguments, SizeType next, UInt64 plain);
+
+constexpr bool IsPlainFormatArgument(const UInt64 plain, const SizeType index)
+{
+    return index < 64 && ((plain >> index) & 1) != 0;
+}
+
+constexpr bool IsFormatDigit(const char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+constexpr bool IsFormatAlignment(const char c)
+{
+    return c == '<' || c == '>' || c == '^';
+}
+
+constexpr bool IsFormatRepresentation(const char c)
+{
+    return c == 'b' || c == 'o' || c == 'x' || c == 'X';
+}
+
+constexpr bool IsFormatLiteral(const char c)
+{
+    return c != '\0' && c != '{' && c != '}';
+}
+
+constexpr SizeType FormatLiteralSize(const char* format, SizeType count);
+
+// The second half is only measured when the first one is all literal text
+constexpr SizeType JoinFormatLiteralSize(const char* format, const SizeType count, const SizeType first)
+{
+    return first < count / 2 ? first : first + FormatLiteralSize(format + first, count - first);
+}
+
+// Bytes of literal text, at most count, at the start of the pattern. Measuring it in halves keeps the
+// recursion depth logarithmic in count, and no byte past the end of the pattern is read.
+constexpr SizeType FormatLiteralSize(const char* format, const SizeType count)
+{
+    return count == 1 ? (IsFormatLiteral(*format) ? 1 : 0)
+                      : JoinFormatLiteralSize(format, count, FormatLiteralSize(format, count / 2));
+}
+
+constexpr SizeType FormatLiteralBlock = 256;
+
+// Whether the pattern has count more bytes before its end
+constexpr bool HasFormatBytes(const char* format, const SizeType count)
+{
+    return count == 0 || (*format != '\0' && HasFormatBytes(format + 1, count - 1));
+}
+
+constexpr SizeType FormatFillSize(const char* format)
+{
+    return static_cast<Byte>(*format) < 0xC0   ? 1
+           : static_cast<Byte>(*format) < 0xE0 ? 2
+           : static_cast<Byte>(*format) < 0xF0 ? 3
+                                                : 4;
+}
+
+// Bytes of the [[fill]align] part of a specifier
+constexpr SizeType FormatAlignmentSize(const char* format)
+{
+    return *format != '}' && HasFormatBytes(format, FormatFillSize(format) + 1) &&
+                   IsFormatAlignment(format[FormatFillSize(format)])
+               ? FormatFillSize(format) + 1
+           : IsFormatAlignment(*format) ? 1
+                                        : 0;
+}
+
+constexpr FormatCheck CheckFormatSpecEnd(const char* format, const SizeType arguments, const SizeType next,
+                                         const UInt64 plain)
+{
+    return *format == '}'    ? CheckFormat(format + 1, arguments, next, plain)
+           : *format == '\0' ? FormatCheck::MismatchedBraces
+                             : FormatCheck::IncorrectSpecifier;
+}
+
+// [type], the # flag needs one of the b, o and x representations
+constexpr FormatCheck CheckFormatType(const char* format, const SizeType arguments, const SizeType next,
+                                      const UInt64 plain, const bool restricted, const bool prefixed)
+{
+    return IsFormatRepresentation(*format) && restricted ? FormatCheck::UnsupportedSpecifier
+           : IsFormatRepresentation(*format)             ? CheckFormatSpecEnd(format + 1, arguments, next, plain)
+           : prefixed                                    ? FormatCheck::IncorrectSpecifier
+           : *format == 's' || *format == 'd' || *format == 'f'
+               ? CheckFormatSpecEnd(format + 1, arguments, next, plain)
+               : CheckFormatSpecEnd(format, arguments, next, plain);
+}
+
+constexpr FormatCheck CheckFormatPrecision(const char* format, const SizeType arguments, const SizeType next,
+                                           const UInt64 plain, const bool restricted, const bool prefixed)
+{
+    return IsFormatDigit(*format) ? CheckFormatPrecision(format + 1, arguments, next, plain, restricted, prefixed)
+                                  : CheckFormatType(format, arguments, next, plain, restricted, prefixed);
+}
+
+// [.precision]
+constexpr FormatCheck CheckFormatDot(const char* format, const SizeType arguments, const SizeType next,
+                                     const UInt64 plain, const bool restricted, const bool prefixed)
+{
+    return *format == '.' ? CheckFormatPrecision(format + 1, arguments, next, plain, restricted, prefixed)
+                          : CheckFormatType(format, arguments, next, plain, restricted, prefixed);
+}
+
+// [,|_]
+constexpr FormatCheck CheckFormatGrouping(const char* format, const SizeType arguments, const SizeType next,
+                                          const UInt64 plain, const bool restricted, const bool prefixed)
+{
+    return (*format == ',' || *format == '_') && restricted ? FormatCheck::UnsupportedSpecifier
+           : *format == ',' || *format == '_' ? CheckFormatDot(format + 1, arguments, next, plain, restricted, prefixed)
+                                              : CheckFormatDot(format, arguments, next, plain, restricted, prefixed);
+}
+
+// [0][width]
+constexpr FormatCheck CheckFormatWidth(const char* format, const SizeType arguments, const SizeType next,
+                                       const UInt64 plain, const bool restricted, const bool prefixed)
+{
+    return IsFormatDigit(*format) ? CheckFormatWidth(format + 1, arguments, next, plain, restricted, prefixed)
+                                  : CheckFormatGrouping(format, arguments, next, plain, restricted, prefixed);
+}
+
+// [[fill]align][#], the rest of the specifier follows
+constexpr FormatCheck CheckFormatSpec(const char* format, const SizeType arguments, const SizeType next,
+                                      const UInt64 plain, const bool restricted)
+{
+    return format[FormatAlignmentSize(format)] == '#'
+               ? CheckFormatWidth(format + FormatAlignmentSize(format) + 1, arguments, next, plain, restricted, true)
+               : CheckFormatWidth(format + FormatAlignmentSize(format), arguments, next, plain, restricted, false);
+}
+
+constexpr FormatCheck CheckFormatFieldEnd(const char* format, const SizeType arguments, const SizeType next,
+                                          const UInt64 plain, const SizeType index)
+{
+    return *format == '}'    ? CheckFormat(format + 1, arguments, next, plain)
+           : *format == ':'  ? CheckFormatSpec(format + 1, arguments, next, plain, IsPlainFormatArgument(plain, index))
+           : *format == '\0' ? FormatCheck::MismatchedBraces
+                             : FormatCheck::IncorrectSpecifier;
+}
+
+constexpr FormatCheck CheckFormatIndex(const char* format, const SizeType arguments, const SizeType next,
+                                       const UInt64 plain, const SizeType index)
+{
+    return IsFormatDigit(*format)
+               ? CheckFormatIndex(format + 1, arguments, next, plain, index * 10 + static_cast<SizeType>(*format - '0'))
+           : index >= arguments ? FormatCheck::IndexOutOfRange
+                                : CheckFormatFieldEnd(format, arguments, next, plain, index);
+}
+
+constexpr FormatCheck CheckFormatField(const char* format, const SizeType arguments, const SizeType next,
+                                       const UInt64 plain)
+{
+    return IsFormatDigit(*format)               ? CheckFormatIndex(format, arguments, next, plain, 0)
+           : arguments == 0                     ? FormatCheck::MissingArgument
+           : arguments > 1 && next >= arguments ? FormatCheck::IndexOutOfRange
+                                                : CheckFormatFieldEnd(format, arguments, next + 1, plain,
+                                                                      arguments == 1 ? 0 : next);
+}
+
+constexpr FormatCheck CheckFormat(const char* format, const SizeType arguments, const SizeType next,
+                                  const UInt64 plain)
+{
+    return *format == '\0'                     ? FormatCheck::Valid
+           : IsFormatLiteral(*format)           ? CheckFormat(format + FormatLiteralSize(format, FormatLiteralBlock),
+                                                              arguments, next, plain)
+           : *format == '{' && format[1] == '{' ? CheckFormat(format + 2, arguments, next, plain)
+           : *format == '{'                     ? CheckFormatField(format + 1, arguments, next, plain)
+           : format[1] == '}'                   ? CheckFormat(format + 2, arguments, next, plain)
+                                                : FormatCheck::SingleRightBracket;
+}
+
+template <typename... Args>
+std::integral_constant<SizeType, sizeof...(Args)> CountFormatArguments(const char*, const Args&...);
+
+__CAITLYN_DETAIL_NAMESPACE_END
+
+constexpr bool IsValidFormat(const char* format, const SizeType arguments)
+{
+    return __Detail::CheckFormat(format, arguments, 0, 0) == __Detail::FormatCheck::Valid;
+}
+
+// Also checks that text and floating-point arguments, marked in the plain mask, get no representation
+// or grouping
+constexpr bool IsValidFormat(const char* format, const SizeType arguments, const UInt64 plain)
+{
+    return __Detail::CheckFormat(format, arguments, 0, plain) == __Detail::FormatCheck::Valid;
+}
+
+// Format pattern parsed once. Formatting with it only emits the literal parts and the arguments.
+class FormatString
+{
+public:
+    using Segment = __Detail::FormatSegment;
+
+public:
+    explicit FormatString(const StringView& pattern) : pattern_{pattern.data(), pattern.ByteCount()}
+    {
+        Parse();
+    }
+
+    explicit FormatString(const char* pattern) : FormatString(StringView{pattern})
+    {
+    }
+
+public:
+    const std::vector<Segment>& Segments() const
+    {
+        return segments_;
+    }
+
+    const char* Pattern() const
+    {
+        return pattern_.data();
+    }
+
+    // Throws FormatError if the fields do not fit the number of arguments
+    void Check(const SizeType arguments) const
+    {
+        if (automatic_ > 0 && arguments == 0)
+        {
+            throw FormatError{__Detail::FormatCheckMessage(__Detail::FormatCheck::MissingArgument)};
+        }
+        if (indexed_ > arguments || (arguments > 1 && automatic_ > arguments))
+        {
+            throw FormatError{__Detail::FormatCheckMessage(__Detail::FormatCheck::IndexOutOfRange)};
+        }
+    }
+
+    // Index of the argument for the field
+    static SizeType Argument(const Segment& segment, const SizeType arguments)
+    {
+        return segment.automatic && arguments == 1 ? 0 : segment.argument;
+    }
+
+    // Parsed pattern from the per-thread cache, the pattern is parsed on first use
+    static const FormatString& Cached(const StringView& pattern)
+    {
+        static constexpr SizeType Capacity = 256;
+        thread_local std::unordered_map<StringView, std::unique_ptr<FormatString>, __Detail::StringViewHash> cache;
+
+        const auto it = cache.find(pattern);
+
+        if (it != cache.end())
+        {
+            return *it->second;
+        }
+        // Patterns of unfinished format calls on this thread must stay alive
+        if (cache.size() >= Capacity && ActiveCalls() == 0)
+        {
+            cache.clear();
+        }
+        std::unique_ptr<FormatString> parsed{new FormatString{pattern}};
+        const auto key = __Detail::MakeTrustedView(parsed->pattern_.data(), pattern.ByteCount(), pattern.Length());
+        return *cache.emplace(key, std::move(parsed)).first->second;
+    }
+
+    // Marks a format call in progress on this thread for its lifetime
+    class Usage
+    {
+    public:
+        Usage()
+        {
+            ++ActiveCalls();
+        }
+
+        Usage(const Usage&) = delete;
+        Usage& operator=(const Usage&) = delete;
+
+        ~Usage()
+        {
+            --ActiveCalls();
+        }
+    };
+
+private:
+    static SizeType& ActiveCalls()
+    {
+        thread_local SizeType calls = 0;
+        return calls;
+    }
+
+    void Parse()
+    {
+        const char* data = pattern_.data();
+        const SizeType size = pattern_.size();
+        SizeType literal = 0;
+        SizeType pos = 0;
+
+        while (pos < size)
+        {
+            if (data[pos] == '{' && pos + 1 < size && data[pos + 1] == '{')
+            {
+                AddLiteral(literal, pos + 1);
+                literal = pos += 2;
+            }
+            else if (data[pos] == '}' && pos + 1 < size && data[pos + 1] == '}')
+            {
+                AddLiteral(literal, pos + 1);
+                literal = pos += 2;
+            }
+            else if (data[pos] == '}')
+            {
+                Fail(__Detail::FormatCheck::SingleRightBracket);
+            }
+            else if (data[pos] == '{')
+            {
+                AddLiteral(literal, pos);
+                pos = ParseField(pos + 1);
+                literal = pos;
+            }
+            else
+            {
+                ++pos;
+            }
+        }
+        AddLiteral(literal, size);
+    }
+
+    // Parses the field after the left bracket, returns the position after its right bracket
+    SizeType ParseField(SizeType pos)
+    {
+        const char* data = pattern_.data();
+        const SizeType end = pattern_.find('}', pos);
+
+        if (end == std::string::npos)
+        {
+            Fail(__Detail::FormatCheck::MismatchedBraces);
+        }
+        Segment segment;
+
+        if (IsDigitByte(data[pos]))
+        {
+            segment.argument = 0;
+
+            for (; IsDigitByte(data[pos]); ++pos)
+            {
+                if (segment.argument > (Segment::Literal - 9) / 10)
+                {
+                    Fail(__Detail::FormatCheck::IndexOutOfRange);
+                }
+                segment.argument = segment.argument * 10 + static_cast<SizeType>(data[pos] - '0');
+            }
+            indexed_ = std::max(indexed_, segment.argument + 1);
+        }
+        else
+        {
+            segment.automatic = true;
+            segment.argument = automatic_++;
+        }
+        if (data[pos] == ':')
+        {
+            segment.specified = true;
+            ParseSpec(pos + 1, end, segment.spec);
+        }
+        else if (pos != end)
+        {
+            Fail(__Detail::FormatCheck::IncorrectSpecifier);
+        }
+        segments_.push_back(segment);
+        return end + 1;
+    }
+
+    // [[fill]align][#][0][width][,|_][.precision][type], where type is one of s d f b o x X
+    void ParseSpec(SizeType pos, const SizeType end, __Detail::FormatSpecifier& spec) const
+    {
+        const char* data = pattern_.data();
+        bool prefixed = false;
+
+        if (pos < end)
+        {
+            const SizeType fill_size = __Detail::Utf8SequenceLength(data[pos]);
+
+            if (pos + fill_size < end && IsAlignment(data[pos + fill_size]))
+            {
+                spec.fill = Char{data + pos, fill_size};
+                pos += fill_size;
+            }
+            if (IsAlignment(data[pos]))
+            {
+                spec.align = data[pos] == '<' ? __Detail::FormatAlignment::Left
+                             : data[pos] == '>' ? __Detail::FormatAlignment::Right
+                                                : __Detail::FormatAlignment::Center;
+                ++pos;
+            }
+        }
+        if (pos < end && data[pos] == '#')
+        {
+            prefixed = true;
+            ++pos;
+        }
+        if (pos < end && data[pos] == '0')
+        {
+            spec.zero = true;
+            ++pos;
+        }
+        for (; pos < end && IsDigitByte(data[pos]); ++pos)
+        {
+            spec.width = spec.width * 10 + static_cast<SizeType>(data[pos] - '0');
+        }
+        if (pos < end && (data[pos] == ',' || data[pos] == '_'))
+        {
+            spec.grouping = data[pos++];
+        }
+        if (pos < end && data[pos] == '.')
+        {
+            for (spec.precision = 0, ++pos; pos < end && IsDigitByte(data[pos]); ++pos)
+            {
+                spec.precision = spec.precision * 10 + (data[pos] - '0');
+            }
+        }
+        if (pos < end)
+        {
+            switch (data[pos++])
+            {
+                case 's':
+                    spec.type = __Detail::FormatValueType::String;
+                    break;
+                case 'd':
+                    spec.type = __Detail::FormatValueType::Integral;
+                    break;
+                case 'f':
+                    spec.type = __Detail::FormatValueType::Floating;
+                    break;
+                case 'b':
+                    spec.type = __Detail::FormatValueType::Integral;
+                    spec.repr = prefixed ? __Detail::FormatRepresentation::BinaryPrefixed
+                                         : __Detail::FormatRepresentation::Binary;
+                    break;
+                case 'o':
+                    spec.type = __Detail::FormatValueType::Integral;
+                    spec.repr = prefixed ? __Detail::FormatRepresentation::OctalPrefixed
+                                         : __Detail::FormatRepresentation::Octal;
+                    break;
+                case 'X':
+                    spec.uppercase = true;
+                    // fall through
+                case 'x':
+                    spec.type = __Detail::FormatValueType::Integral;
+                    spec.repr = prefixed ? __Detail::FormatRepresentation::HexPrefixed
+                                         : __Detail::FormatRepresentation::Hex;
+                    break;
+                default:
+                    Fail(__Detail::FormatCheck::IncorrectSpecifier);
+            }
+        }
+        if (pos != end || (prefixed && spec.repr == __Detail::FormatRepresentation::Default))
+        {
+            Fail(__Detail::FormatCheck::IncorrectSpecifier);
+        }
+    }
+
+    void AddLiteral(const SizeType first, const SizeType last)
+    {
+        if (first < last)
+        {
+            Segment segment;
+            segment.offset = first;
+            segment.bytes = last - first;
+            segment.length = __Detail::CountUtf8CodePoints(pattern_.data() + first, last - first);
+            segments_.push_back(segment);
+        }
+    }
+
+    static bool IsDigitByte(const char byte)
+    {
+        return byte >= '0' && byte <= '9';
+    }
+
+    static bool IsAlignment(const char byte)
+    {
+        return byte == '<' || byte == '>' || byte == '^';
+    }
+
+    [[noreturn]] static void Fail(const __Detail::FormatCheck check)
+    {
+        throw FormatError{__Detail::FormatCheckMessage(check)};
+    }
+
+private:
+    std::string pattern_;
+    std::vector<Segment> segments_;
+    SizeType automatic_ = 0;
+    SizeType indexed_ = 0;
+};
+
+__CAITLYN_GLOBAL_NAMESPACE_END
+
+#endif // CAITLYN_CORE_STRING_FORMAT_STRING_H_
@@ -0,0 +1,198 @@
+/**
+ * This file is part of the Caitlyn library
+ * Copyright (C) 2024 Alexander Szawrowski
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CAITLYN_CORE_STRING_HASH_H_
+#define CAITLYN_CORE_STRING_HASH_H_
+
+#include <cstring>
+#include <functional>
+#include <random>
+
+#include "Caitlyn/__Base.h"
+#include "Caitlyn/__Core/Char.h"
+#include "Caitlyn/__Core/String/Multiply.h"
+#include "Caitlyn/__Core/String/StringView.h"
+
+__CAITLYN_GLOBAL_NAMESPACE_BEGIN
+__CAITLYN_DETAIL_NAMESPACE_BEGIN
+
+// Secrets of wyhash by Wang Yi
+constexpr UInt64 HashSecret0 = 0xA0761D6478BD642FULL;
+constexpr UInt64 HashSecret1 = 0xE7037ED1A0B428DBULL;
+constexpr UInt64 HashSecret2 = 0x8EBC6AF09C88C6E3ULL;
+constexpr UInt64 HashSecret3 = 0x589965CC75374CC3ULL;
+
+inline UInt64 HashMix(const UInt64 a, const UInt64 b)
+{
+    UInt64 low;
+    const UInt64 high = MultiplyHigh(a, b, low);
+    return low ^ high;
+}
+
+inline UInt64 HashRead8(const char* data)
+{
+    UInt64 value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+inline UInt64 HashRead4(const char* data)
+{
+    UInt32 value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+// wyhash over the bytes: 48-byte blocks go through three independent multiply chains,
+// inputs of up to 16 bytes take two overlapping reads and a single multiplication
+inline UInt64 HashBytes64(const char* data, const SizeType size, UInt64 seed)
+{
+    seed ^= HashMix(seed ^ HashSecret0, HashSecret1);
+    UInt64 a = 0;
+    UInt64 b = 0;
+
+    if (size <= 16)
+    {
+        if (size >= 4)
+        {
+            const SizeType shift = (size >> 3) << 2;
+            a = HashRead4(data) << 32 | HashRead4(data + shift);
+            b = HashRead4(data + size - 4) << 32 | HashRead4(data + size - 4 - shift);
+        }
+        else if (size > 0)
+        {
+            a = static_cast<UInt64>(static_cast<Byte>(data[0])) << 16 |
+                static_cast<UInt64>(static_cast<Byte>(data[size >> 1])) << 8 | static_cast<Byte>(data[size - 1]);
+        }
+    }
+    else
+    {
+        const char* p = data;
+        SizeType left = size;
+
+        if (left > 48)
+        {
+            UInt64 first = seed;
+            UInt64 second = seed;
+
+            do
+            {
+                seed = HashMix(HashRead8(p) ^ HashSecret1, HashRead8(p + 8) ^ seed);
+                first = HashMix(HashRead8(p + 16) ^ HashSecret2, HashRead8(p + 24) ^ first);
+                second = HashMix(HashRead8(p + 32) ^ HashSecret3, HashRead8(p + 40) ^ second);
+                p += 48;
+                left -= 48;
+            }
+            while (left > 48);
+            seed ^= first ^ second;
+        }
+        while (left > 16)
+        {
+            seed = HashMix(HashRead8(p) ^ HashSecret1, HashRead8(p + 8) ^ seed);
+            p += 16;
+            left -= 16;
+        }
+        a = HashRead8(p + left - 16);
+        b = HashRead8(p + left - 8);
+    }
+    UInt64 low;
+    const UInt64 high = MultiplyHigh(a ^ HashSecret1, b ^ seed, low);
+    return HashMix(low ^ HashSecret0 ^ size, high ^ HashSecret1);
+}
+
+inline SizeType HashBytes(const char* data, const SizeType size, const UInt64 seed = 0)
+{
+    return static_cast<SizeType>(HashBytes64(data, size, seed));
+}
+
+struct StringViewHash
+{
+    SizeType operator()(const StringView& view) const
+    {
+        return HashBytes(view.data(), view.ByteCount());
+    }
+};
+
+__CAITLYN_DETAIL_NAMESPACE_END
+
+// Fast non-cryptographic hash of the UTF-8 bytes. Different seeds give unrelated hash functions,
+// a secret seed keeps an attacker from choosing keys that collide.
+inline SizeType Hash(const StringView& text, const UInt64 seed = 0)
+{
+    return __Detail::HashBytes(text.data(), text.ByteCount(), seed);
+}
+
+// Seed drawn once per process from std::random_device
+inline UInt64 RandomHashSeed()
+{
+    static const UInt64 seed = []() -> UInt64
+    {
+        std::random_device device;
+        return static_cast<UInt64>(device()) << 32 ^ device();
+    }();
+    return seed;
+}
+
+// Hasher for unordered containers keyed by String, StringView or ImmutableString
+class StringHash
+{
+public:
+    StringHash() = default;
+
+    explicit StringHash(const UInt64 seed) : seed_{seed}
+    {
+    }
+
+public:
+    SizeType operator()(const StringView& text) const
+    {
+        return Hash(text, seed_);
+    }
+
+    UInt64 Seed() const
+    {
+        return seed_;
+    }
+
+private:
+    UInt64 seed_ = 0;
+};
+
+__CAITLYN_GLOBAL_NAMESPACE_END
+
+namespace std
+{
+template <>
+struct hash<Caitlyn::StringView>
+{
+    size_t operator()(const Caitlyn::StringView& view) const noexcept
+    {
+        return Caitlyn::Hash(view);
+    }
+};
+
+template <>
+struct hash<Caitlyn::Char>
+{
+    size_t operator()(const Caitlyn::Char& ch) const noexcept
+    {
+        return Caitlyn::__Detail::HashBytes(ch.data(), ch.size());
+    }
+};
+} // namespace std
+
+#endif // CAITLYN_CORE_STRING_HASH_H_
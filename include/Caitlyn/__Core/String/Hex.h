@@ -0,0 +1,171 @@
+/**
+ * This file is part of the Caitlyn library
+ * Copyright (C) 2024 Alexander Szawrowski
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CAITLYN_CORE_STRING_HEX_H_
+#define CAITLYN_CORE_STRING_HEX_H_
+
+#include <algorithm>
+#include <cstring>
+#include <ostream>
+
+#include "Caitlyn/__Core/String/Format.h"
+#include "Caitlyn/__Core/String/NumberFormat.h"
+#include "Caitlyn/__Core/String/String.h"
+#include "Caitlyn/__Core/String/StringView.h"
+
+__CAITLYN_GLOBAL_NAMESPACE_BEGIN
+
+// Bytes written as hexadecimal digits, e.g. String::Format("{:#X}", HexBytes{digest, 16}).
+// The x and X types select the case, # adds the 0x prefix; the bytes are not copied.
+class HexBytes
+{
+public:
+    HexBytes(const void* data, const SizeType size) : data_{static_cast<const Byte*>(data)}, size_{size}
+    {
+    }
+
+    explicit HexBytes(const StringView& bytes) : HexBytes(bytes.data(), bytes.ByteCount())
+    {
+    }
+
+public:
+    String ToString() const
+    {
+        return String::Format("{}", *this);
+    }
+
+    void WriteFormat(FormatBuffer& buffer, const __Detail::FormatSpecifier* spec) const
+    {
+        const bool uppercase = spec != nullptr && spec->uppercase;
+        const bool prefixed = spec != nullptr && spec->repr == __Detail::FormatRepresentation::HexPrefixed;
+        SizeType right = 0;
+
+        if (spec != nullptr)
+        {
+            right = __Detail::FormatWriter::WritePadding(buffer, size_ * 2 + (prefixed ? 2 : 0), *spec);
+        }
+        if (prefixed)
+        {
+            buffer.Append(uppercase ? "0X" : "0x", 2);
+        }
+        char digits[256];
+
+        for (SizeType offset = 0; offset < size_; offset += sizeof(digits) / 2)
+        {
+            const SizeType count = std::min<SizeType>(sizeof(digits) / 2, size_ - offset);
+            __Detail::WriteHexBytes(digits, data_ + offset, count, uppercase);
+            buffer.Append(digits, count * 2);
+        }
+        if (spec != nullptr)
+        {
+            buffer.Append(right, spec->fill);
+        }
+    }
+
+private:
+    const Byte* data_;
+    SizeType size_;
+};
+
+// Classic dump of a byte buffer, sixteen bytes per line with the offset, the hexadecimal bytes
+// and their printable ASCII characters:
+// 00000000  48 65 6c 6c 6f 2c 20 77  6f 72 6c 64 21 0a        |Hello, world!.|
+class HexDump
+{
+public:
+    HexDump(const void* data, const SizeType size, const SizeType offset = 0)
+        : data_{static_cast<const Byte*>(data)}, size_{size}, offset_{offset}
+    {
+    }
+
+    explicit HexDump(const StringView& bytes, const SizeType offset = 0)
+        : HexDump(bytes.data(), bytes.ByteCount(), offset)
+    {
+    }
+
+public:
+    String ToString() const
+    {
+        return String::Format("{}", *this);
+    }
+
+    // The X type prints uppercase digits, the other specifier fields do not apply to the lines
+    void WriteFormat(FormatBuffer& buffer, const __Detail::FormatSpecifier* spec) const
+    {
+        const bool uppercase = spec != nullptr && spec->uppercase;
+        const char* table =
+            uppercase ? __Detail::RadixDigitTables().hex_upper : __Detail::RadixDigitTables().hex_lower;
+
+        for (SizeType first = 0; first < size_; first += LineBytes)
+        {
+            const SizeType count = size_ - first < LineBytes ? size_ - first : LineBytes;
+
+            // Offset of at least eight digits, two spaces, the bytes in two halves, the text column
+            char line[16 + 2 + LineBytes * 3 + 2 + 1 + LineBytes + 2];
+            char offset[16];
+            char* const offset_end = offset + sizeof(offset);
+            const char* digits = __Detail::WriteHexBackward(offset_end, offset_ + first, uppercase);
+            const auto digit_count = std::max<SizeType>(8, static_cast<SizeType>(offset_end - digits));
+            char* out = line + digit_count;
+
+            std::memset(line, '0', digit_count);
+            std::memcpy(out - (offset_end - digits), digits, static_cast<SizeType>(offset_end - digits));
+            std::memset(out, ' ', 2 + LineBytes * 3 + 2);
+            out += 2;
+
+            for (SizeType i = 0; i < count; ++i)
+            {
+                std::memcpy(out + i * 3 + (i >= LineBytes / 2 ? 1 : 0), table + data_[first + i] * 2, 2);
+            }
+            out += LineBytes * 3 + 2;
+            *out++ = '|';
+
+            for (SizeType i = 0; i < count; ++i)
+            {
+                const Byte byte = data_[first + i];
+                *out++ = byte >= 0x20 && byte < 0x7F ? static_cast<char>(byte) : '.';
+            }
+            *out++ = '|';
+            *out++ = '\n';
+            buffer.Append(line, static_cast<SizeType>(out - line));
+        }
+    }
+
+private:
+    static constexpr SizeType LineBytes = 16;
+
+private:
+    const Byte* data_;
+    SizeType size_;
+    SizeType offset_;
+};
+
+__CAITLYN_GLOBAL_NAMESPACE_END
+
+inline std::ostream& operator<<(std::ostream& os, const Caitlyn::HexBytes& bytes)
+{
+    Caitlyn::FormatTo(os, "{}", bytes);
+    return os;
+}
+
+inline std::ostream& operator<<(std::ostream& os, const Caitlyn::HexDump& dump)
+{
+    Caitlyn::FormatTo(os, "{}", dump);
+    return os;
+}
+
+#endif // CAITLYN_CORE_STRING_HEX_H_
@@ -0,0 +1,289 @@
+/**
+ * This file is part of the Caitlyn library
+ * Copyright (C) 2024 Alexander Szawrowski
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CAITLYN_CORE_STRING_IGNORECASE_H_
+#define CAITLYN_CORE_STRING_IGNORECASE_H_
+
+#include <cstring>
+
+#include "Caitlyn/__Base.h"
+#include "Caitlyn/__Core/Char/Utility.h"
+#include "Caitlyn/__Core/String/Algorithms/Search.h"
+#include "Caitlyn/__Core/String/Hash.h"
+#include "Caitlyn/__Core/String/Simd.h"
+#include "Caitlyn/__Core/String/StringView.h"
+#include "Caitlyn/__Core/String/Utf8.h"
+
+__CAITLYN_GLOBAL_NAMESPACE_BEGIN
+__CAITLYN_DETAIL_NAMESPACE_BEGIN
+
+inline Byte FoldAscii(const Byte byte)
+{
+    return static_cast<UInt32>(byte - 'A') < 26 ? static_cast<Byte>(byte | 0x20) : byte;
+}
+
+// Folded code point at the start of the bytes and the length of its sequence
+inline CodePoint FoldNext(const char* data, SizeType& length)
+{
+    const auto lead = static_cast<Byte>(data[0]);
+
+    if (lead < 0x80)
+    {
+        length = 1;
+        return FoldAscii(lead);
+    }
+    length = Utf8SequenceLength(data[0]);
+    return FoldCase(DecodeUtf8(data));
+}
+
+#if __CAITLYN_HAS_SSE2
+// Sets the case bit of the ASCII uppercase letters, other bytes are kept
+inline __m128i FoldAsciiBlock(const __m128i input)
+{
+    const __m128i upper =
+        _mm_and_si128(_mm_cmpgt_epi8(input, _mm_set1_epi8('A' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('Z' + 1), input));
+    return _mm_or_si128(input, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+}
+#endif
+
+// Matches the whole pattern at the start of the text ignoring case. Returns the number of text
+// bytes it covers, which may differ from the pattern size, or NotFound.
+inline SizeType MatchIgnoreCase(const char* text, const SizeType text_size, const char* pattern,
+                                const SizeType pattern_size)
+{
+    SizeType i = 0;
+    SizeType j = 0;
+
+    while (j < pattern_size)
+    {
+#if __CAITLYN_HAS_SSE2
+        // Sixteen ASCII bytes on both sides are folded and compared at once
+        if (i + 16 <= text_size && j + 16 <= pattern_size)
+        {
+            const __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+            const __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pattern + j));
+
+            if (_mm_movemask_epi8(_mm_or_si128(left, right)) == 0)
+            {
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(FoldAsciiBlock(left), FoldAsciiBlock(right))) != 0xFFFF)
+                {
+                    return NotFound;
+                }
+                i += 16;
+                j += 16;
+                continue;
+            }
+        }
+#endif
+        if (i >= text_size)
+        {
+            return NotFound;
+        }
+        SizeType left_length;
+        SizeType right_length;
+
+        if (FoldNext(text + i, left_length) != FoldNext(pattern + j, right_length))
+        {
+            return NotFound;
+        }
+        i += left_length;
+        j += right_length;
+    }
+    return i;
+}
+
+// Offset of the first of the two bytes at or after the position
+inline SizeType FindEitherByte(const char* data, const SizeType size, SizeType from, const char first,
+                               const char second)
+{
+    if (first == second)
+    {
+        return FindBytes(data, size, &first, 1, from);
+    }
+#if __CAITLYN_HAS_SSE2
+    const __m128i first_block = _mm_set1_epi8(first);
+    const __m128i second_block = _mm_set1_epi8(second);
+
+    for (; from + 16 <= size; from += 16)
+    {
+        const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + from));
+        const auto mask = static_cast<UInt32>(_mm_movemask_epi8(
+            _mm_or_si128(_mm_cmpeq_epi8(input, first_block), _mm_cmpeq_epi8(input, second_block))));
+
+        if (mask != 0)
+        {
+            return from + CountTrailingZeros(mask);
+        }
+    }
+#endif
+    for (; from < size; ++from)
+    {
+        if (data[from] == first || data[from] == second)
+        {
+            return from;
+        }
+    }
+    return NotFound;
+}
+
+__CAITLYN_DETAIL_NAMESPACE_END
+
+// Case-insensitive operations compare code points after simple case folding, the C and S entries of
+// CaseFolding.txt. Neither side is copied, ASCII runs are folded sixteen bytes at a time.
+
+inline bool EqualsIgnoreCase(const StringView& left, const StringView& right)
+{
+    // Simple folding maps one code point to one code point
+    return left.Length() == right.Length() &&
+           __Detail::MatchIgnoreCase(left.data(), left.ByteCount(), right.data(), right.ByteCount()) ==
+               left.ByteCount();
+}
+
+inline bool StartsWithIgnoreCase(const StringView& text, const StringView& prefix)
+{
+    return __Detail::MatchIgnoreCase(text.data(), text.ByteCount(), prefix.data(), prefix.ByteCount()) !=
+           __Detail::NotFound;
+}
+
+// Position of the first case-insensitive occurrence at or after the position, like String::Find
+inline SizeType FindIgnoreCase(const StringView& text, const StringView& pattern, const SizeType pos = 0)
+{
+    if (pos > text.Length())
+    {
+        return StringView::NPosition;
+    }
+    const char* data = text.data();
+    const SizeType size = text.ByteCount();
+    SizeType from = text.IsAscii() ? pos : __Detail::Utf8ByteOffset(data, size, pos);
+    SizeType found = __Detail::NotFound;
+
+    if (pattern.IsEmpty())
+    {
+        found = from;
+    }
+    else
+    {
+        SizeType length;
+        const CodePoint first = __Detail::FoldNext(pattern.data(), length);
+
+        // Only K (Kelvin sign) and ſ fold to ASCII letters, other first letters are found by byte
+        if (first < 0x80 && first != 'k' && first != 's')
+        {
+            const auto lower = static_cast<char>(first);
+            const auto upper = static_cast<char>(first - 'a' < 26u ? first - 0x20 : first);
+
+            for (; (from = __Detail::FindEitherByte(data, size, from, lower, upper)) != __Detail::NotFound; ++from)
+            {
+                if (__Detail::MatchIgnoreCase(data + from, size - from, pattern.data(), pattern.ByteCount()) !=
+                    __Detail::NotFound)
+                {
+                    found = from;
+                    break;
+                }
+            }
+        }
+        else
+        {
+            for (; from < size; from += length)
+            {
+                if (__Detail::FoldNext(data + from, length) == first &&
+                    __Detail::MatchIgnoreCase(data + from, size - from, pattern.data(), pattern.ByteCount()) !=
+                        __Detail::NotFound)
+                {
+                    found = from;
+                    break;
+                }
+            }
+        }
+    }
+    if (found == __Detail::NotFound)
+    {
+        return StringView::NPosition;
+    }
+    return text.IsAscii() ? found : __Detail::CountUtf8CodePoints(data, found);
+}
+
+// Hash of the case-folded text, equal for strings that are equal ignoring case
+inline SizeType HashIgnoreCase(const StringView& text, const UInt64 seed = 0)
+{
+    // The folded bytes are hashed in pieces of a fixed size, each piece seeding the next one,
+    // so the result does not depend on which runs took the ASCII path
+    constexpr SizeType Piece = 256;
+    char buffer[Piece + 16];
+    SizeType used = 0;
+    UInt64 hash = seed;
+    const char* data = text.data();
+    const SizeType size = text.ByteCount();
+
+    for (SizeType i = 0; i < size;)
+    {
+#if __CAITLYN_HAS_SSE2
+        const __m128i input =
+            i + 16 <= size ? _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)) : _mm_set1_epi8(-1);
+
+        if (_mm_movemask_epi8(input) == 0)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(buffer + used), __Detail::FoldAsciiBlock(input));
+            used += 16;
+            i += 16;
+        }
+        else
+#endif
+        {
+            SizeType length;
+            const CodePoint folded = __Detail::FoldNext(data + i, length);
+
+            if (folded < 0x80)
+            {
+                buffer[used++] = static_cast<char>(folded);
+            }
+            else
+            {
+                used += __Detail::EncodeUtf8(folded, buffer + used);
+            }
+            i += length;
+        }
+        if (used >= Piece)
+        {
+            hash = __Detail::HashBytes64(buffer, Piece, hash);
+            used -= Piece;
+            std::memmove(buffer, buffer + Piece, used);
+        }
+    }
+    return static_cast<SizeType>(__Detail::HashBytes64(buffer, used, hash));
+}
+
+// Hasher and key equality for unordered containers that ignore case
+struct IgnoreCaseHash
+{
+    SizeType operator()(const StringView& text) const
+    {
+        return HashIgnoreCase(text);
+    }
+};
+
+struct IgnoreCaseEqual
+{
+    bool operator()(const StringView& left, const StringView& right) const
+    {
+        return EqualsIgnoreCase(left, right);
+    }
+};
+
+__CAITLYN_GLOBAL_NAMESPACE_END
+
+#endif // CAITLYN_CORE_STRING_IGNORECASE_H_
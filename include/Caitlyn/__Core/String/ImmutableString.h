@@ -0,0 +1,321 @@
+/**
+ * This file is part of the Caitlyn library
+ * Copyright (C) 2024 Alexander Szawrowski
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CAITLYN_CORE_STRING_IMMUTABLE_STRING_H_
+#define CAITLYN_CORE_STRING_IMMUTABLE_STRING_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+
+#include "Caitlyn/__Base.h"
+#include "Caitlyn/__Core/Char.h"
+#include "Caitlyn/__Core/String/Hash.h"
+#include "Caitlyn/__Core/String/Index.h"
+#include "Caitlyn/__Core/String/String.h"
+#include "Caitlyn/__Core/String/StringView.h"
+#include "Caitlyn/__Core/String/Utf8.h"
+
+__CAITLYN_GLOBAL_NAMESPACE_BEGIN
+__CAITLYN_DETAIL_NAMESPACE_BEGIN
+
+// Shared header of an immutable string, the NUL-terminated bytes follow it in the same allocation
+struct ImmutableStringData
+{
+    std::atomic<SizeType> references{1};
+    SizeType bytes = 0;
+    SizeType length = 0;
+    SizeType hash = 0;
+    StringIndex index;
+
+    const char* Bytes() const
+    {
+        return reinterpret_cast<const char*>(this + 1);
+    }
+
+    static ImmutableStringData* Create(const StringView& view)
+    {
+        void* memory = ::operator new(sizeof(ImmutableStringData) + view.ByteCount() + 1);
+        auto* data = new (memory) ImmutableStringData{};
+        auto* bytes = reinterpret_cast<char*>(data + 1);
+        std::memcpy(bytes, view.data(), view.ByteCount());
+        bytes[view.ByteCount()] = '\0';
+        data->bytes = view.ByteCount();
+        data->length = view.Length();
+        data->hash = HashBytes(bytes, data->bytes);
+        return data;
+    }
+
+    static void Retain(ImmutableStringData* data)
+    {
+        if (data)
+        {
+            data->references.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    static void Release(ImmutableStringData* data)
+    {
+        if (data && data->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            data->~ImmutableStringData();
+            ::operator delete(data);
+        }
+    }
+};
+
+__CAITLYN_DETAIL_NAMESPACE_END
+
+// Read-only string sharing one reference-counted buffer between its copies.
+// Copies are O(1) and may be used from several threads; the hash is computed once on construction.
+class ImmutableString
+{
+public:
+    using CharType = Char;
+
+public:
+    ImmutableString() = default;
+
+    ImmutableString(const char* str) : ImmutableString(StringView{str})
+    {
+    }
+
+    ImmutableString(const String& str) : ImmutableString(str.View())
+    {
+    }
+
+    explicit ImmutableString(const StringView& view)
+        : data_{view.IsEmpty() ? nullptr : __Detail::ImmutableStringData::Create(view)}
+    {
+    }
+
+    ImmutableString(const ImmutableString& other) noexcept : data_{other.data_}
+    {
+        __Detail::ImmutableStringData::Retain(data_);
+    }
+
+    ImmutableString(ImmutableString&& other) noexcept : data_{other.data_}
+    {
+        other.data_ = nullptr;
+    }
+
+    ImmutableString& operator=(const ImmutableString& other) noexcept
+    {
+        __Detail::ImmutableStringData::Retain(other.data_);
+        __Detail::ImmutableStringData::Release(data_);
+        data_ = other.data_;
+        return *this;
+    }
+
+    ImmutableString& operator=(ImmutableString&& other) noexcept
+    {
+        std::swap(data_, other.data_);
+        return *this;
+    }
+
+    ~ImmutableString()
+    {
+        __Detail::ImmutableStringData::Release(data_);
+    }
+
+public:
+    SizeType size() const
+    {
+        return data_ ? data_->length : 0;
+    }
+
+    SizeType Length() const
+    {
+        return size();
+    }
+
+    SizeType ByteCount() const
+    {
+        return data_ ? data_->bytes : 0;
+    }
+
+    bool IsEmpty() const
+    {
+        return data_ == nullptr;
+    }
+
+    bool NotEmpty() const
+    {
+        return data_ != nullptr;
+    }
+
+    bool IsAscii() const
+    {
+        return size() == ByteCount();
+    }
+
+    // Pointer to the NUL-terminated UTF-8 bytes
+    const char* data() const
+    {
+        return data_ ? data_->Bytes() : "";
+    }
+
+    SizeType Hash() const
+    {
+        return data_ ? data_->hash : __Detail::HashBytes("", 0);
+    }
+
+    // Number of copies sharing the buffer, 0 for an empty string
+    SizeType UseCount() const
+    {
+        return data_ ? data_->references.load(std::memory_order_relaxed) : 0;
+    }
+
+    StringView View() const
+    {
+        return __Detail::MakeTrustedView(data(), ByteCount(), size());
+    }
+
+    operator StringView() const
+    {
+        return View();
+    }
+
+    String ToString() const
+    {
+        return String{View()};
+    }
+
+public:
+    CharType operator[](const SizeType index) const
+    {
+        const SizeType offset = ByteOffset(index);
+        return CharType{data() + offset, __Detail::Utf8SequenceLength(data()[offset])};
+    }
+
+    CharType At(const SizeType index) const
+    {
+        if (index >= size())
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        return (*this)[index];
+    }
+
+    bool StartsWith(const StringView& prefix) const
+    {
+        return View().StartsWith(prefix);
+    }
+
+    bool EndsWith(const StringView& suffix) const
+    {
+        return View().EndsWith(suffix);
+    }
+
+    bool Contains(const StringView& substring) const
+    {
+        return View().Contains(substring);
+    }
+
+public:
+    bool operator==(const ImmutableString& other) const
+    {
+        return data_ == other.data_ || (Hash() == other.Hash() && View() == other.View());
+    }
+
+    bool operator!=(const ImmutableString& other) const
+    {
+        return !(*this == other);
+    }
+
+    bool operator==(const StringView& other) const
+    {
+        return View() == other;
+    }
+
+    bool operator!=(const StringView& other) const
+    {
+        return View() != other;
+    }
+
+    bool operator==(const char* other) const
+    {
+        return View() == StringView{other};
+    }
+
+    bool operator!=(const char* other) const
+    {
+        return !(*this == other);
+    }
+
+    bool operator==(const String& other) const
+    {
+        return View() == other.View();
+    }
+
+    bool operator!=(const String& other) const
+    {
+        return !(*this == other);
+    }
+
+    bool operator<(const ImmutableString& other) const
+    {
+        return View() < other.View();
+    }
+
+private:
+    SizeType ByteOffset(const SizeType index) const
+    {
+        if (IsAscii() || index == 0)
+        {
+            return std::min(index, ByteCount());
+        }
+        if (index >= size())
+        {
+            return ByteCount();
+        }
+        if (size() <= __Detail::StringIndex::Stride)
+        {
+            return __Detail::Utf8ByteOffset(data(), ByteCount(), index);
+        }
+        return data_->index.ByteOffset(data(), ByteCount(), index);
+    }
+
+private:
+    __Detail::ImmutableStringData* data_ = nullptr;
+};
+
+__CAITLYN_GLOBAL_NAMESPACE_END
+
+namespace std
+{
+template <>
+struct hash<Caitlyn::ImmutableString>
+{
+    size_t operator()(const Caitlyn::ImmutableString& str) const noexcept
+    {
+        return str.Hash();
+    }
+};
+} // namespace std
+
+inline std::ostream& operator<<(std::ostream& os, const Caitlyn::ImmutableString& str)
+{
+    return os << str.View();
+}
+
+#endif // CAITLYN_CORE_STRING_IMMUTABLE_STRING_H_
@@ -0,0 +1,156 @@
+/**
+ * This file is part of the Caitlyn library
+ * Copyright (C) 2024 Alexander Szawrowski
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CAITLYN_CORE_STRING_INDEX_H_
+#define CAITLYN_CORE_STRING_INDEX_H_
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "Caitlyn/__Base.h"
+#include "Caitlyn/__Core/String/Utf8.h"
+
+__CAITLYN_GLOBAL_NAMESPACE_BEGIN
+__CAITLYN_DETAIL_NAMESPACE_BEGIN
+
+// Sparse map from code point indices to byte offsets, built on first use.
+// Stores the byte offset of every Stride-th code point; copies start without an index.
+class StringIndex
+{
+public:
+    using Checkpoints = std::vector<SizeType>;
+
+public:
+    static constexpr SizeType Stride = 32;
+
+public:
+    StringIndex() = default;
+
+    StringIndex(const StringIndex&) noexcept
+    {
+    }
+
+    // A moved-from index is not shared with other threads, plain loads and stores are enough
+    StringIndex(StringIndex&& other) noexcept : checkpoints_{other.checkpoints_.load(std::memory_order_relaxed)}
+    {
+        other.checkpoints_.store(nullptr, std::memory_order_relaxed);
+    }
+
+    StringIndex& operator=(const StringIndex& other) noexcept
+    {
+        if (this != &other)
+        {
+            Reset();
+        }
+        return *this;
+    }
+
+    StringIndex& operator=(StringIndex&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Checkpoints* previous = checkpoints_.load(std::memory_order_relaxed);
+            checkpoints_.store(other.checkpoints_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            other.checkpoints_.store(nullptr, std::memory_order_relaxed);
+            delete previous;
+        }
+        return *this;
+    }
+
+    ~StringIndex()
+    {
+        delete checkpoints_.load(std::memory_order_acquire);
+    }
+
+public:
+    SizeType ByteOffset(const char* data, const SizeType size, const SizeType index) const
+    {
+        const Checkpoints& checkpoints = Get(data, size);
+        SizeType offset = checkpoints[index / Stride];
+
+        for (SizeType i = index % Stride; i > 0; --i)
+        {
+            offset = Utf8NextOffset(data, offset);
+        }
+        return offset;
+    }
+
+    SizeType CodePointIndex(const char* data, const SizeType size, const SizeType offset) const
+    {
+        const Checkpoints& checkpoints = Get(data, size);
+        const auto it = std::upper_bound(checkpoints.begin(), checkpoints.end(), offset) - 1;
+        const auto index = static_cast<SizeType>(it - checkpoints.begin()) * Stride;
+        return index + CountUtf8CodePoints(data + *it, offset - *it);
+    }
+
+    // Drops the index, must be called whenever the indexed bytes change
+    void Reset() noexcept
+    {
+        delete checkpoints_.exchange(nullptr, std::memory_order_acq_rel);
+    }
+
+private:
+    const Checkpoints& Get(const char* data, const SizeType size) const
+    {
+        Checkpoints* checkpoints = checkpoints_.load(std::memory_order_acquire);
+
+        if (checkpoints == nullptr)
+        {
+            auto* built = new Checkpoints{Build(data, size)};
+
+            // Concurrent readers may build the index at the same time, the first one wins
+            if (checkpoints_.compare_exchange_strong(checkpoints, built, std::memory_order_acq_rel))
+            {
+                checkpoints = built;
+            }
+            else
+            {
+                delete built;
+            }
+        }
+        return *checkpoints;
+    }
+
+    static Checkpoints Build(const char* data, const SizeType size)
+    {
+        Checkpoints checkpoints;
+        checkpoints.reserve(size / Stride + 1);
+
+        SizeType count = 0;
+        for (SizeType offset = 0; offset < size; offset = Utf8NextOffset(data, offset), ++count)
+        {
+            if (count % Stride == 0)
+            {
+                checkpoints.push_back(offset);
+            }
+        }
+        if (checkpoints.empty())
+        {
+            checkpoints.push_back(0);
+        }
+        return checkpoints;
+    }
+
+private:
+    mutable std::atomic<Checkpoints*> checkpoints_{nullptr};
+};
+
+__CAITLYN_DETAIL_NAMESPACE_END
+__CAITLYN_GLOBAL_NAMESPACE_END
+
+#endif // CAITLYN_CORE_STRING_INDEX_H_
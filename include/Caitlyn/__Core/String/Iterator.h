@@ -0,0 +1,312 @@
+/**
+ * This file is part of the Caitlyn library
+ * Copyright (C) 2024 Alexander Szawrowski
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CAITLYN_CORE_STRING_ITERATOR_H_
+#define CAITLYN_CORE_STRING_ITERATOR_H_
+
+#include <iterator>
+#include <ostream>
+
+#include "Caitlyn/__Base.h"
+#include "Caitlyn/__Core/Char.h"
+#include "Caitlyn/__Core/String/Utf8.h"
+
+__CAITLYN_GLOBAL_NAMESPACE_BEGIN
+__CAITLYN_DETAIL_NAMESPACE_BEGIN
+
+template <typename StringT, bool Reverse>
+class StringIterator;
+
+// Proxy to a code point inside the UTF-8 buffer of a string
+template <typename StringT>
+class StringCharReference
+{
+public:
+    StringCharReference(StringT* str, const SizeType offset) : string_{str}, offset_{offset}
+    {
+    }
+
+    StringCharReference(const StringCharReference& other) = default;
+
+public:
+    StringCharReference& operator=(const Char& ch)
+    {
+        string_->ReplaceChar(offset_, ch);
+        return *this;
+    }
+
+    StringCharReference& operator=(const StringCharReference& other)
+    {
+        return *this = other.Get();
+    }
+
+    operator Char() const
+    {
+        return Get();
+    }
+
+public:
+    Char Get() const
+    {
+        return string_->CharAt(offset_);
+    }
+
+    CodePoint GetCodePoint() const
+    {
+        return DecodeUtf8(string_->data() + offset_);
+    }
+
+    SizeType size() const
+    {
+        return Utf8SequenceLength(string_->data()[offset_]);
+    }
+
+    bool operator>(const Char& other) const
+    {
+        return Get() > other;
+    }
+
+    bool operator<(const Char& other) const
+    {
+        return Get() < other;
+    }
+
+    bool operator>=(const Char& other) const
+    {
+        return Get() >= other;
+    }
+
+    bool operator<=(const Char& other) const
+    {
+        return Get() <= other;
+    }
+
+    bool operator==(const Char& other) const
+    {
+        return Get() == other;
+    }
+
+    bool operator!=(const Char& other) const
+    {
+        return !(*this == other);
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const StringCharReference& ch)
+    {
+        os << ch.Get();
+        return os;
+    }
+
+private:
+    template <typename, bool>
+    friend class StringIterator;
+
+    StringT* string_;
+    SizeType offset_;
+};
+
+// Moves a byte offset one code point forward or backward, the reverse end is NotFound
+template <bool Reverse>
+struct StringIteratorStep
+{
+    static SizeType Next(const char* data, const SizeType offset)
+    {
+        return Utf8NextOffset(data, offset);
+    }
+
+    static SizeType Prev(const char* data, const SizeType offset)
+    {
+        return Utf8PrevOffset(data, offset);
+    }
+};
+
+template <>
+struct StringIteratorStep<true>
+{
+    static SizeType Next(const char* data, const SizeType offset)
+    {
+        return offset == 0 ? static_cast<SizeType>(-1) : Utf8PrevOffset(data, offset);
+    }
+
+    static SizeType Prev(const char* data, const SizeType offset)
+    {
+        return offset == static_cast<SizeType>(-1) ? 0 : Utf8NextOffset(data, offset);
+    }
+};
+
+template <typename StringT, bool Reverse>
+class StringIterator
+{
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Char;
+    using difference_type = PtrDiff;
+    using reference = StringCharReference<StringT>&;
+    using pointer = StringCharReference<StringT>*;
+
+public:
+    StringIterator(StringT* str, const SizeType offset) : reference_{str, offset}
+    {
+    }
+
+    StringIterator(const StringIterator& other) : reference_{other.reference_.string_, other.reference_.offset_}
+    {
+    }
+
+    StringIterator& operator=(const StringIterator& other)
+    {
+        reference_.string_ = other.reference_.string_;
+        reference_.offset_ = other.reference_.offset_;
+        return *this;
+    }
+
+public:
+    reference operator*() const
+    {
+        return reference_;
+    }
+
+    pointer operator->() const
+    {
+        return &reference_;
+    }
+
+    StringIterator& operator++()
+    {
+        reference_.offset_ = StringIteratorStep<Reverse>::Next(reference_.string_->data(), reference_.offset_);
+        return *this;
+    }
+
+    StringIterator operator++(int)
+    {
+        StringIterator tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    StringIterator& operator--()
+    {
+        reference_.offset_ = StringIteratorStep<Reverse>::Prev(reference_.string_->data(), reference_.offset_);
+        return *this;
+    }
+
+    StringIterator operator--(int)
+    {
+        StringIterator tmp = *this;
+        --*this;
+        return tmp;
+    }
+
+    bool operator==(const StringIterator& other) const
+    {
+        return reference_.offset_ == other.reference_.offset_ && reference_.string_ == other.reference_.string_;
+    }
+
+    bool operator!=(const StringIterator& other) const
+    {
+        return !(*this == other);
+    }
+
+    // Byte offset of the current code point
+    SizeType Offset() const
+    {
+        return reference_.offset_;
+    }
+
+private:
+    mutable StringCharReference<StringT> reference_;
+};
+
+template <typename StringT, bool Reverse>
+class StringConstIterator
+{
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Char;
+    using difference_type = PtrDiff;
+    using reference = const Char&;
+    using pointer = const Char*;
+
+public:
+    StringConstIterator(const StringT* str, const SizeType offset) : string_{str}, offset_{offset}
+    {
+    }
+
+public:
+    reference operator*() const
+    {
+        current_ = string_->CharAt(offset_);
+        return current_;
+    }
+
+    pointer operator->() const
+    {
+        return &**this;
+    }
+
+    StringConstIterator& operator++()
+    {
+        offset_ = StringIteratorStep<Reverse>::Next(string_->data(), offset_);
+        return *this;
+    }
+
+    StringConstIterator operator++(int)
+    {
+        StringConstIterator tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    StringConstIterator& operator--()
+    {
+        offset_ = StringIteratorStep<Reverse>::Prev(string_->data(), offset_);
+        return *this;
+    }
+
+    StringConstIterator operator--(int)
+    {
+        StringConstIterator tmp = *this;
+        --*this;
+        return tmp;
+    }
+
+    bool operator==(const StringConstIterator& other) const
+    {
+        return offset_ == other.offset_ && string_ == other.string_;
+    }
+
+    bool operator!=(const StringConstIterator& other) const
+    {
+        return !(*this == other);
+    }
+
+    // Byte offset of the current code point
+    SizeType Offset() const
+    {
+        return offset_;
+    }
+
+private:
+    const StringT* string_;
+    SizeType offset_;
+    mutable Char current_;
+};
+
+__CAITLYN_DETAIL_NAMESPACE_END
+__CAITLYN_GLOBAL_NAMESPACE_END
+
+#endif // CAITLYN_CORE_STRING_ITERATOR_H_
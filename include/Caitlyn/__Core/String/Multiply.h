@@ -0,0 +1,54 @@
+/**
+ * This file is part of the Caitlyn library
+ * Copyright (C) 2024 Alexander Szawrowski
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CAITLYN_CORE_STRING_MULTIPLY_H_
+#define CAITLYN_CORE_STRING_MULTIPLY_H_
+
+#include "Caitlyn/__Base.h"
+
+__CAITLYN_GLOBAL_NAMESPACE_BEGIN
+__CAITLYN_DETAIL_NAMESPACE_BEGIN
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 UInt128;
+#endif
+
+// High word of the 128-bit product, the low word is stored in low
+inline UInt64 MultiplyHigh(const UInt64 a, const UInt64 b, UInt64& low)
+{
+#if defined(__SIZEOF_INT128__)
+    const UInt128 product = static_cast<UInt128>(a) * b;
+    low = static_cast<UInt64>(product);
+    return static_cast<UInt64>(product >> 64);
+#else
+    const UInt64 a_low = a & 0xFFFFFFFF;
+    const UInt64 a_high = a >> 32;
+    const UInt64 b_low = b & 0xFFFFFFFF;
+    const UInt64 b_high = b >> 32;
+    const UInt64 low_low = a_low * b_low;
+    const UInt64 low_high = a_low * b_high;
+    const UInt64 high_low = a_high * b_low;
+    const UInt64 middle = (low_low >> 32) + (high_low & 0xFFFFFFFF) + (low_high & 0xFFFFFFFF);
+    low = (middle << 32) | (low_low & 0xFFFFFFFF);
+    return a_high * b_high + (high_low >> 32) + (low_high >> 32) + (middle >> 32);
+#endif
+}
+
+__CAITLYN_DETAIL_NAMESPACE_END
+__CAITLYN_GLOBAL_NAMESPACE_END
+
+#endif // CAITLYN_CORE_STRING_MULTIPLY_H_
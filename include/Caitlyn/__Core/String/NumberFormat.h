@@ -0,0 +1,740 @@
+/**
+ * This file is part of the Caitlyn library
+ * Copyright (C) 2024 Alexander Szawrowski
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CAITLYN_CORE_STRING_NUMBER_FORMAT_H_
+#define CAITLYN_CORE_STRING_NUMBER_FORMAT_H_
+
+#include <cfloat>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "Caitlyn/__Base.h"
+#include "Caitlyn/__Core/String/Multiply.h"
+#include "Caitlyn/__Core/String/Pow5Table.h"
+
+__CAITLYN_GLOBAL_NAMESPACE_BEGIN
+__CAITLYN_DETAIL_NAMESPACE_BEGIN
+
+inline const char* DecimalDigitPairs()
+{
+    static const char pairs[] =
+        "00010203040506070809101112131415161718192021222324"
+        "25262728293031323334353637383940414243444546474849"
+        "50515253545556575859606162636465666768697071727374"
+        "75767778798081828384858687888990919293949596979899";
+    return pairs;
+}
+
+inline UInt64 PowerOf10(const UInt32 exponent)
+{
+    static const UInt64 powers[] = {1ULL,
+                                    10ULL,
+                                    100ULL,
+                                    1000ULL,
+                                    10000ULL,
+                                    100000ULL,
+                                    1000000ULL,
+                                    10000000ULL,
+                                    100000000ULL,
+                                    1000000000ULL,
+                                    10000000000ULL,
+                                    100000000000ULL,
+                                    1000000000000ULL,
+                                    10000000000000ULL,
+                                    100000000000000ULL,
+                                    1000000000000000ULL,
+                                    10000000000000000ULL,
+                                    100000000000000000ULL,
+                                    1000000000000000000ULL,
+                                    10000000000000000000ULL};
+    return powers[exponent];
+}
+
+// Writes the digits so that they end at the given position, two digits per step. Returns the first digit.
+inline char* WriteDecimalBackward(char* end, UInt64 value)
+{
+    const char* pairs = DecimalDigitPairs();
+
+    while (value >= 100)
+    {
+        const auto index = static_cast<SizeType>(value % 100) * 2;
+        value /= 100;
+        end -= 2;
+        end[0] = pairs[index];
+        end[1] = pairs[index + 1];
+    }
+    if (value >= 10)
+    {
+        const auto index = static_cast<SizeType>(value) * 2;
+        end -= 2;
+        end[0] = pairs[index];
+        end[1] = pairs[index + 1];
+    }
+    else
+    {
+        *--end = static_cast<char>('0' + value);
+    }
+    return end;
+}
+
+// Decimal digits of the magnitude preceded by the minus sign when the value is negative
+inline char* WriteSignedDecimalBackward(char* end, const UInt64 magnitude, const bool negative)
+{
+    char* begin = WriteDecimalBackward(end, magnitude);
+
+    if (negative)
+    {
+        *--begin = '-';
+    }
+    return begin;
+}
+
+inline char* WriteSignedDecimalBackward(char* end, const Int64 value)
+{
+    const auto magnitude = static_cast<UInt64>(value);
+    return WriteSignedDecimalBackward(end, value < 0 ? 0 - magnitude : magnitude, value < 0);
+}
+
+// Two hexadecimal digits and eight binary digits for every byte value
+struct RadixTables
+{
+    RadixTables()
+    {
+        static const char lower[] = "0123456789abcdef";
+        static const char upper[] = "0123456789ABCDEF";
+
+        for (SizeType byte = 0; byte < 256; ++byte)
+        {
+            hex_lower[byte * 2] = lower[byte >> 4];
+            hex_lower[byte * 2 + 1] = lower[byte & 0x0F];
+            hex_upper[byte * 2] = upper[byte >> 4];
+            hex_upper[byte * 2 + 1] = upper[byte & 0x0F];
+
+            for (SizeType bit = 0; bit < 8; ++bit)
+            {
+                binary[byte * 8 + bit] = ((byte >> (7 - bit)) & 1) != 0 ? '1' : '0';
+            }
+        }
+    }
+
+    char hex_lower[512];
+    char hex_upper[512];
+    char binary[2048];
+};
+
+inline const RadixTables& RadixDigitTables()
+{
+    static const RadixTables tables;
+    return tables;
+}
+
+// Hexadecimal digits of the bytes in memory order, the output needs twice the size
+inline void WriteHexBytes(char* out, const Byte* bytes, const SizeType size, const bool uppercase)
+{
+    const char* table = uppercase ? RadixDigitTables().hex_upper : RadixDigitTables().hex_lower;
+
+    for (SizeType i = 0; i < size; ++i)
+    {
+        std::memcpy(out + i * 2, table + bytes[i] * 2, 2);
+    }
+}
+
+// The radix writers end the digits at the given position and return the first digit, like WriteDecimalBackward
+inline char* WriteHexBackward(char* end, UInt64 value, const bool uppercase)
+{
+    const char* table = uppercase ? RadixDigitTables().hex_upper : RadixDigitTables().hex_lower;
+
+    do
+    {
+        end -= 2;
+        std::memcpy(end, table + (value & 0xFF) * 2, 2);
+        value >>= 8;
+    }
+    while (value != 0);
+
+    // The leading byte may start with a zero digit, a single zero digit is kept for zero
+    return *end == '0' ? end + 1 : end;
+}
+
+inline char* WriteBinaryBackward(char* end, UInt64 value)
+{
+    const char* table = RadixDigitTables().binary;
+    char* const last = end - 1;
+
+    do
+    {
+        end -= 8;
+        std::memcpy(end, table + (value & 0xFF) * 8, 8);
+        value >>= 8;
+    }
+    while (value != 0);
+
+    while (end != last && *end == '0')
+    {
+        ++end;
+    }
+    return end;
+}
+
+inline char* WriteOctalBackward(char* end, UInt64 value)
+{
+    do
+    {
+        *--end = static_cast<char>('0' + (value & 7));
+        value >>= 3;
+    }
+    while (value != 0);
+
+    return end;
+}
+
+// Decimal significand and exponent, the value is mantissa * 10^exponent
+struct DecimalFloat
+{
+    UInt64 mantissa;
+    Int32 exponent;
+};
+
+// Shortest decimal that rounds to the same binary value, from "Ryu: fast float-to-string conversion"
+// (Adams, PLDI 2018). The binary format is described by the width of its mantissa and its exponent bias.
+struct ShortestDecimal
+{
+    static DecimalFloat Convert(const UInt64 mantissa, const Int32 exponent, const Int32 mantissa_width,
+                                const Int32 bias)
+    {
+        DecimalFloat small;
+
+        if (ConvertInteger(mantissa, exponent, mantissa_width, bias, small))
+        {
+            return small;
+        }
+        Int32 e2;
+        UInt64 m2;
+
+        if (exponent == 0)
+        {
+            e2 = 1 - bias - mantissa_width - 2;
+            m2 = mantissa;
+        }
+        else
+        {
+            e2 = exponent - bias - mantissa_width - 2;
+            m2 = (1ULL << mantissa_width) | mantissa;
+        }
+        const bool accept_bounds = (m2 & 1) == 0;
+        const UInt64 mv = 4 * m2;
+        const UInt32 mm_shift = mantissa != 0 || exponent <= 1 ? 1 : 0;
+
+        UInt64 vr;
+        UInt64 vp;
+        UInt64 vm;
+        Int32 e10;
+        bool vm_trailing_zeros = false;
+        bool vr_trailing_zeros = false;
+
+        if (e2 >= 0)
+        {
+            const UInt32 q = Log10Pow2(e2) - (e2 > 3 ? 1 : 0);
+            e10 = static_cast<Int32>(q);
+            const Int32 k = Pow5InverseBitCount + Pow5Bits(static_cast<Int32>(q)) - 1;
+            const Int32 i = -e2 + static_cast<Int32>(q) + k;
+            const UInt64* multiplier = Pow5InverseSplit(q);
+            vr = MulShift(4 * m2, multiplier, i);
+            vp = MulShift(4 * m2 + 2, multiplier, i);
+            vm = MulShift(4 * m2 - 1 - mm_shift, multiplier, i);
+
+            if (q <= 21)
+            {
+                if (mv % 5 == 0)
+                {
+                    vr_trailing_zeros = IsMultipleOfPow5(mv, q);
+                }
+                else if (accept_bounds)
+                {
+                    vm_trailing_zeros = IsMultipleOfPow5(mv - 1 - mm_shift, q);
+                }
+                else
+                {
+                    vp -= IsMultipleOfPow5(mv + 2, q) ? 1 : 0;
+                }
+            }
+        }
+        else
+        {
+            const UInt32 q = Log10Pow5(-e2) - (-e2 > 1 ? 1 : 0);
+            e10 = static_cast<Int32>(q) + e2;
+            const Int32 i = -e2 - static_cast<Int32>(q);
+            const Int32 k = Pow5Bits(i) - Pow5BitCount;
+            const Int32 j = static_cast<Int32>(q) - k;
+            const UInt64* multiplier = Pow5Split(static_cast<UInt32>(i));
+            vr = MulShift(4 * m2, multiplier, j);
+            vp = MulShift(4 * m2 + 2, multiplier, j);
+            vm = MulShift(4 * m2 - 1 - mm_shift, multiplier, j);
+
+            if (q <= 1)
+            {
+                // mv has at least q trailing zero bits, so vr is exact
+                vr_trailing_zeros = true;
+
+                if (accept_bounds)
+                {
+                    vm_trailing_zeros = mm_shift == 1;
+                }
+                else
+                {
+                    --vp;
+                }
+            }
+            else if (q < 63)
+            {
+                vr_trailing_zeros = IsMultipleOfPow2(mv, q);
+            }
+        }
+
+        // Drop digits while the interval still holds a shorter number
+        Int32 removed = 0;
+        UInt32 last_removed = 0;
+        UInt64 output;
+
+        if (vm_trailing_zeros || vr_trailing_zeros)
+        {
+            while (vp / 10 > vm / 10)
+            {
+                vm_trailing_zeros &= vm % 10 == 0;
+                vr_trailing_zeros &= last_removed == 0;
+                last_removed = static_cast<UInt32>(vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                ++removed;
+            }
+            if (vm_trailing_zeros)
+            {
+                while (vm % 10 == 0)
+                {
+                    vr_trailing_zeros &= last_removed == 0;
+                    last_removed = static_cast<UInt32>(vr % 10);
+                    vr /= 10;
+                    vp /= 10;
+                    vm /= 10;
+                    ++removed;
+                }
+            }
+            // Exactly halfway between two candidates rounds to even
+            if (vr_trailing_zeros && last_removed == 5 && vr % 2 == 0)
+            {
+                last_removed = 4;
+            }
+            output = vr + ((vr == vm && (!accept_bounds || !vm_trailing_zeros)) || last_removed >= 5 ? 1 : 0);
+        }
+        else
+        {
+            bool round_up = false;
+
+            if (vp / 100 > vm / 100)
+            {
+                round_up = vr % 100 >= 50;
+                vr /= 100;
+                vp /= 100;
+                vm /= 100;
+                removed += 2;
+            }
+            while (vp / 10 > vm / 10)
+            {
+                round_up = vr % 10 >= 5;
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                ++removed;
+            }
+            output = vr + (vr == vm || round_up ? 1 : 0);
+        }
+        return DecimalFloat{output, e10 + removed};
+    }
+
+private:
+    // Integers below 2^(width + 1) are printed from their own digits
+    static bool ConvertInteger(const UInt64 mantissa, const Int32 exponent, const Int32 mantissa_width,
+                               const Int32 bias, DecimalFloat& result)
+    {
+        const Int32 e2 = exponent - bias - mantissa_width;
+
+        if (exponent == 0 || e2 > 0 || e2 < -mantissa_width)
+        {
+            return false;
+        }
+        const UInt64 m2 = (1ULL << mantissa_width) | mantissa;
+        const UInt64 fraction = m2 & ((1ULL << -e2) - 1);
+
+        if (fraction != 0)
+        {
+            return false;
+        }
+        result.mantissa = m2 >> -e2;
+        result.exponent = 0;
+
+        while (result.mantissa % 10 == 0)
+        {
+            result.mantissa /= 10;
+            ++result.exponent;
+        }
+        return true;
+    }
+
+    // ceil(log2(5^e)), or 1 for e == 0
+    static Int32 Pow5Bits(const Int32 e)
+    {
+        return static_cast<Int32>((static_cast<UInt32>(e) * 1217359) >> 19) + 1;
+    }
+
+    static UInt32 Log10Pow2(const Int32 e)
+    {
+        return (static_cast<UInt32>(e) * 78913) >> 18;
+    }
+
+    static UInt32 Log10Pow5(const Int32 e)
+    {
+        return (static_cast<UInt32>(e) * 732923) >> 20;
+    }
+
+    static bool IsMultipleOfPow5(UInt64 value, const UInt32 power)
+    {
+        UInt32 count = 0;
+
+        while (value % 5 == 0)
+        {
+            value /= 5;
+            ++count;
+        }
+        return count >= power;
+    }
+
+    static bool IsMultipleOfPow2(const UInt64 value, const UInt32 power)
+    {
+        return (value & ((1ULL << power) - 1)) == 0;
+    }
+
+    // (m * multiplier) >> shift, where the multiplier is a 128-bit {low, high} pair and shift is above 64
+    static UInt64 MulShift(const UInt64 m, const UInt64* multiplier, const Int32 shift)
+    {
+        UInt64 low0;
+        UInt64 low1;
+        const UInt64 high0 = MultiplyHigh(m, multiplier[0], low0);
+        const UInt64 high1 = MultiplyHigh(m, multiplier[1], low1);
+        const UInt64 sum = high0 + low1;
+        const UInt64 high = high1 + (sum < high0 ? 1 : 0);
+        const Int32 distance = shift - 64;
+        return (high << (64 - distance)) | (sum >> distance);
+    }
+};
+
+// Writes the decimal in fixed or scientific notation, whichever is shorter
+inline SizeType WriteDecimalFloat(const DecimalFloat& decimal, char* out)
+{
+    char digits[20];
+    char* const digits_end = digits + sizeof(digits);
+    const char* first = WriteDecimalBackward(digits_end, decimal.mantissa);
+    const auto length = static_cast<Int32>(digits_end - first);
+    const Int32 exponent = decimal.exponent;
+    const Int32 scientific = exponent + length - 1;
+
+    Int32 fixed_size;
+
+    if (exponent >= 0)
+    {
+        fixed_size = length + exponent;
+    }
+    else if (length + exponent > 0)
+    {
+        fixed_size = length + 1;
+    }
+    else
+    {
+        fixed_size = 2 - exponent;
+    }
+    const Int32 scientific_size = length + (length > 1 ? 1 : 0) + 2 + (scientific >= 100 || scientific <= -100 ? 3 : 2);
+    char* p = out;
+
+    if (fixed_size <= scientific_size)
+    {
+        if (exponent >= 0)
+        {
+            std::memcpy(p, first, length);
+            p += length;
+            std::memset(p, '0', exponent);
+            p += exponent;
+        }
+        else if (length + exponent > 0)
+        {
+            const Int32 integral = length + exponent;
+            std::memcpy(p, first, integral);
+            p += integral;
+            *p++ = '.';
+            std::memcpy(p, first + integral, -exponent);
+            p += -exponent;
+        }
+        else
+        {
+            *p++ = '0';
+            *p++ = '.';
+            std::memset(p, '0', -exponent - length);
+            p += -exponent - length;
+            std::memcpy(p, first, length);
+            p += length;
+        }
+        return static_cast<SizeType>(p - out);
+    }
+    *p++ = first[0];
+
+    if (length > 1)
+    {
+        *p++ = '.';
+        std::memcpy(p, first + 1, length - 1);
+        p += length - 1;
+    }
+    *p++ = 'e';
+    *p++ = scientific < 0 ? '-' : '+';
+    const auto magnitude = static_cast<UInt32>(scientific < 0 ? -scientific : scientific);
+
+    if (magnitude >= 100)
+    {
+        *p++ = static_cast<char>('0' + magnitude / 100);
+    }
+    std::memcpy(p, DecimalDigitPairs() + magnitude % 100 * 2, 2);
+    p += 2;
+    return static_cast<SizeType>(p - out);
+}
+
+// IEEE 754 layout of a floating type
+template <typename T>
+struct FloatingLayout;
+
+template <>
+struct FloatingLayout<double>
+{
+    using Bits = UInt64;
+    static constexpr Int32 MantissaWidth = 52;
+    static constexpr Int32 ExponentWidth = 11;
+    static constexpr Int32 Bias = 1023;
+};
+
+template <>
+struct FloatingLayout<float>
+{
+    using Bits = UInt32;
+    static constexpr Int32 MantissaWidth = 23;
+    static constexpr Int32 ExponentWidth = 8;
+    static constexpr Int32 Bias = 127;
+};
+
+// Parts of a floating value, the exponent is the biased field
+struct FloatingParts
+{
+    bool negative;
+    Int32 exponent;
+    UInt64 mantissa;
+    bool infinite;
+    bool nan;
+};
+
+template <typename T>
+FloatingParts DecomposeFloating(const T value)
+{
+    using Layout = FloatingLayout<T>;
+    typename Layout::Bits bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const Int32 max_exponent = (1 << Layout::ExponentWidth) - 1;
+    const UInt64 mantissa = static_cast<UInt64>(bits) & ((1ULL << Layout::MantissaWidth) - 1);
+    const auto exponent = static_cast<Int32>((static_cast<UInt64>(bits) >> Layout::MantissaWidth) & max_exponent);
+    const bool negative = (static_cast<UInt64>(bits) >> (Layout::MantissaWidth + Layout::ExponentWidth)) != 0;
+    return FloatingParts{negative, exponent, mantissa, exponent == max_exponent && mantissa == 0,
+                         exponent == max_exponent && mantissa != 0};
+}
+
+inline char* WriteSpecialFloating(const FloatingParts& parts, char* p)
+{
+    std::memcpy(p, parts.nan ? "nan" : "inf", 3);
+    return p + 3;
+}
+
+// Shortest text that reads back as the same value. The buffer needs 32 bytes.
+template <typename T>
+SizeType WriteShortest(const T value, char* out)
+{
+    using Layout = FloatingLayout<T>;
+    const FloatingParts parts = DecomposeFloating(value);
+    char* p = out;
+
+    if (parts.negative)
+    {
+        *p++ = '-';
+    }
+    if (parts.infinite || parts.nan)
+    {
+        return static_cast<SizeType>(WriteSpecialFloating(parts, p) - out);
+    }
+    if (parts.exponent == 0 && parts.mantissa == 0)
+    {
+        *p++ = '0';
+        return static_cast<SizeType>(p - out);
+    }
+    const DecimalFloat decimal =
+        ShortestDecimal::Convert(parts.mantissa, parts.exponent, Layout::MantissaWidth, Layout::Bias);
+    return static_cast<SizeType>(p - out) + WriteDecimalFloat(decimal, p);
+}
+
+// Fixed notation with the given number of digits after the point, rounded half to even from the exact
+// binary value. The buffer needs 48 bytes. Returns 0 if the scaled value does not fit in 64 bits.
+inline SizeType WriteFixed(const double value, const Int32 precision, char* out)
+{
+    if (precision < 0 || precision > 19)
+    {
+        return 0;
+    }
+    const FloatingParts parts = DecomposeFloating(value);
+    char* p = out;
+
+    if (parts.negative)
+    {
+        *p++ = '-';
+    }
+    if (parts.infinite || parts.nan)
+    {
+        return static_cast<SizeType>(WriteSpecialFloating(parts, p) - out);
+    }
+    UInt64 scaled = 0;
+
+    if (parts.exponent != 0 || parts.mantissa != 0)
+    {
+        using Layout = FloatingLayout<double>;
+        const UInt64 m2 = parts.exponent == 0 ? parts.mantissa : (1ULL << Layout::MantissaWidth) | parts.mantissa;
+        const Int32 e2 = (parts.exponent == 0 ? 1 : parts.exponent) - Layout::Bias - Layout::MantissaWidth;
+
+        // m2 * 10^precision * 2^e2 as a 128-bit product shifted by e2
+        UInt64 low;
+        const UInt64 high = MultiplyHigh(m2, PowerOf10(static_cast<UInt32>(precision)), low);
+
+        if (e2 >= 0)
+        {
+            if (high != 0 || e2 >= 64 || (e2 > 0 && (low >> (64 - e2)) != 0))
+            {
+                return 0;
+            }
+            scaled = low << e2;
+        }
+        else if (-e2 < 128)
+        {
+            const Int32 shift = -e2;
+            UInt64 remainder_high = 0;
+            UInt64 remainder_low;
+            UInt64 half_high = 0;
+            UInt64 half_low = 0;
+
+            if (shift < 64)
+            {
+                if ((high >> shift) != 0)
+                {
+                    return 0;
+                }
+                scaled = (high << (64 - shift)) | (low >> shift);
+                remainder_low = low & ((1ULL << shift) - 1);
+                half_low = 1ULL << (shift - 1);
+            }
+            else if (shift == 64)
+            {
+                scaled = high;
+                remainder_low = low;
+                half_low = 1ULL << 63;
+            }
+            else
+            {
+                scaled = high >> (shift - 64);
+                remainder_high = high & ((1ULL << (shift - 64)) - 1);
+                remainder_low = low;
+                half_high = 1ULL << (shift - 65);
+            }
+            const bool above = remainder_high > half_high || (remainder_high == half_high && remainder_low > half_low);
+            const bool halfway = remainder_high == half_high && remainder_low == half_low;
+
+            if (above || (halfway && (scaled & 1) != 0))
+            {
+                if (scaled == ~0ULL)
+                {
+                    return 0;
+                }
+                ++scaled;
+            }
+        }
+    }
+    char digits[20];
+    char* const digits_end = digits + sizeof(digits);
+    const char* first = WriteDecimalBackward(digits_end, scaled);
+    const auto length = static_cast<Int32>(digits_end - first);
+
+    if (length <= precision)
+    {
+        *p++ = '0';
+        *p++ = '.';
+        std::memset(p, '0', precision - length);
+        p += precision - length;
+        std::memcpy(p, first, length);
+        p += length;
+        return static_cast<SizeType>(p - out);
+    }
+    const Int32 integral = length - precision;
+    std::memcpy(p, first, integral);
+    p += integral;
+
+    if (precision > 0)
+    {
+        *p++ = '.';
+        std::memcpy(p, first + integral, precision);
+        p += precision;
+    }
+    return static_cast<SizeType>(p - out);
+}
+
+// printf conversion for values outside of the fast paths, the decimal point does not depend on the locale
+template <typename T>
+std::string PrintFloating(const char* conversion, const Int32 precision, const T value)
+{
+    std::string text(64, '\0');
+    int count = std::snprintf(&text[0], text.size(), conversion, precision, value);
+
+    if (count >= static_cast<int>(text.size()))
+    {
+        text.resize(static_cast<SizeType>(count) + 1);
+        count = std::snprintf(&text[0], text.size(), conversion, precision, value);
+    }
+    text.resize(count > 0 ? static_cast<SizeType>(count) : 0);
+
+    for (auto& ch : text)
+    {
+        if (ch == ',')
+        {
+            ch = '.';
+        }
+    }
+    return text;
+}
+
+__CAITLYN_DETAIL_NAMESPACE_END
+__CAITLYN_GLOBAL_NAMESPACE_END
+
+#endif // CAITLYN_CORE_STRING_NUMBER_FORMAT_H_
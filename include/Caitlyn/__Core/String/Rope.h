@@ -0,0 +1,518 @@
+/**
+ * This file is part of the Caitlyn library
+ * Copyright (C) 2024 Alexander Szawrowski
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CAITLYN_CORE_STRING_ROPE_H_
+#define CAITLYN_CORE_STRING_ROPE_H_
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Caitlyn/__Base.h"
+#include "Caitlyn/__Core/Char.h"
+#include "Caitlyn/__Core/String/String.h"
+#include "Caitlyn/__Core/String/StringView.h"
+#include "Caitlyn/__Core/String/Utf8.h"
+
+__CAITLYN_GLOBAL_NAMESPACE_BEGIN
+__CAITLYN_DETAIL_NAMESPACE_BEGIN
+
+// Immutable rope node. Leaves borrow a slice of a shared buffer, branches join two subtrees
+// whose heights differ by at most one.
+struct RopeNode
+{
+    using Pointer = std::shared_ptr<const RopeNode>;
+
+    std::shared_ptr<const std::string> buffer;
+    SizeType offset = 0;
+    Pointer left;
+    Pointer right;
+    SizeType bytes = 0;
+    SizeType length = 0;
+    UInt32 height = 0;
+
+    bool IsLeaf() const
+    {
+        return height == 0;
+    }
+
+    const char* Data() const
+    {
+        return buffer->data() + offset;
+    }
+};
+
+struct RopeTree
+{
+    using Pointer = RopeNode::Pointer;
+
+    // Leaves built from a buffer hold at most this many bytes, smaller neighbours are merged
+    static constexpr SizeType ChunkSize = 1024;
+
+    static UInt32 Height(const Pointer& node)
+    {
+        return node ? node->height : 0;
+    }
+
+    static Pointer MakeLeaf(const std::shared_ptr<const std::string>& buffer, const SizeType offset,
+                            const SizeType bytes, const SizeType length)
+    {
+        if (bytes == 0)
+        {
+            return nullptr;
+        }
+        auto node = std::make_shared<RopeNode>();
+        node->buffer = buffer;
+        node->offset = offset;
+        node->bytes = bytes;
+        node->length = length;
+        return node;
+    }
+
+    static Pointer MakeBranch(const Pointer& left, const Pointer& right)
+    {
+        auto node = std::make_shared<RopeNode>();
+        node->left = left;
+        node->right = right;
+        node->bytes = left->bytes + right->bytes;
+        node->length = left->length + right->length;
+        node->height = std::max(left->height, right->height) + 1;
+        return node;
+    }
+
+    // Balanced tree over the bytes, which must be valid UTF-8
+    static Pointer Build(const char* data, const SizeType size)
+    {
+        if (size == 0)
+        {
+            return nullptr;
+        }
+        const auto buffer = std::make_shared<const std::string>(data, size);
+        std::vector<Pointer> leaves;
+        SizeType offset = 0;
+
+        while (offset < size)
+        {
+            SizeType last = std::min(size, offset + ChunkSize);
+
+            while (last < size && IsUtf8Continuation((*buffer)[last]))
+            {
+                --last;
+            }
+            leaves.push_back(
+                MakeLeaf(buffer, offset, last - offset, CountUtf8CodePoints(buffer->data() + offset, last - offset)));
+            offset = last;
+        }
+        return Build(leaves, 0, leaves.size());
+    }
+
+    static Pointer Build(const std::vector<Pointer>& leaves, const SizeType first, const SizeType last)
+    {
+        if (last - first == 1)
+        {
+            return leaves[first];
+        }
+        const SizeType middle = first + (last - first) / 2;
+        return MakeBranch(Build(leaves, first, middle), Build(leaves, middle, last));
+    }
+
+    // Joins two trees in O(|height(left) - height(right)|)
+    static Pointer Concat(const Pointer& left, const Pointer& right)
+    {
+        if (!left)
+        {
+            return right;
+        }
+        if (!right)
+        {
+            return left;
+        }
+        if (left->IsLeaf() && right->IsLeaf() && left->bytes + right->bytes <= ChunkSize)
+        {
+            auto buffer = std::make_shared<std::string>(left->Data(), left->bytes);
+            buffer->append(right->Data(), right->bytes);
+            return MakeLeaf(std::move(buffer), 0, left->bytes + right->bytes, left->length + right->length);
+        }
+        if (left->height > right->height + 1)
+        {
+            const Pointer joined = Concat(left->right, right);
+
+            if (joined->height <= left->left->height + 1)
+            {
+                return MakeBranch(left->left, joined);
+            }
+            if (Height(joined->right) >= Height(joined->left))
+            {
+                return MakeBranch(MakeBranch(left->left, joined->left), joined->right);
+            }
+            return MakeBranch(MakeBranch(left->left, joined->left->left),
+                              MakeBranch(joined->left->right, joined->right));
+        }
+        if (right->height > left->height + 1)
+        {
+            const Pointer joined = Concat(left, right->left);
+
+            if (joined->height <= right->right->height + 1)
+            {
+                return MakeBranch(joined, right->right);
+            }
+            if (Height(joined->left) >= Height(joined->right))
+            {
+                return MakeBranch(joined->left, MakeBranch(joined->right, right->right));
+            }
+            return MakeBranch(MakeBranch(joined->left, joined->right->left),
+                              MakeBranch(joined->right->right, right->right));
+        }
+        return MakeBranch(left, right);
+    }
+
+    // Splits the tree before the code point with the given index
+    static std::pair<Pointer, Pointer> Split(const Pointer& node, const SizeType index)
+    {
+        if (!node || index == 0)
+        {
+            return {nullptr, node};
+        }
+        if (index >= node->length)
+        {
+            return {node, nullptr};
+        }
+        if (node->IsLeaf())
+        {
+            const SizeType offset = Utf8ByteOffset(node->Data(), node->bytes, index);
+            return {MakeLeaf(node->buffer, node->offset, offset, index),
+                    MakeLeaf(node->buffer, node->offset + offset, node->bytes - offset, node->length - index)};
+        }
+        if (index <= node->left->length)
+        {
+            auto parts = Split(node->left, index);
+            return {std::move(parts.first), Concat(parts.second, node->right)};
+        }
+        auto parts = Split(node->right, index - node->left->length);
+        return {Concat(node->left, parts.first), std::move(parts.second)};
+    }
+
+    static Char CharAt(const RopeNode* node, SizeType index)
+    {
+        while (!node->IsLeaf())
+        {
+            if (index < node->left->length)
+            {
+                node = node->left.get();
+            }
+            else
+            {
+                index -= node->left->length;
+                node = node->right.get();
+            }
+        }
+        const SizeType offset = Utf8ByteOffset(node->Data(), node->bytes, index);
+        return Char{node->Data() + offset, Utf8SequenceLength(node->Data()[offset])};
+    }
+
+    template <typename Function>
+    static void ForEachLeaf(const RopeNode* node, Function& function)
+    {
+        if (!node)
+        {
+            return;
+        }
+        if (node->IsLeaf())
+        {
+            function(*node);
+            return;
+        }
+        ForEachLeaf(node->left.get(), function);
+        ForEachLeaf(node->right.get(), function);
+    }
+};
+
+__CAITLYN_DETAIL_NAMESPACE_END
+
+// Text stored as a balanced tree of immutable UTF-8 chunks. Insertion, erasure, concatenation
+// and substrings take O(log n) and share the chunks with the source; copies are O(1).
+class Rope
+{
+public:
+    using CharType = Char;
+
+public:
+    Rope() = default;
+
+    Rope(const char* str) : Rope(StringView{str})
+    {
+    }
+
+    Rope(const String& str) : Rope(str.View())
+    {
+    }
+
+    explicit Rope(const StringView& view) : root_{__Detail::RopeTree::Build(view.data(), view.ByteCount())}
+    {
+    }
+
+public:
+    SizeType size() const
+    {
+        return root_ ? root_->length : 0;
+    }
+
+    SizeType Length() const
+    {
+        return size();
+    }
+
+    SizeType ByteCount() const
+    {
+        return root_ ? root_->bytes : 0;
+    }
+
+    bool IsEmpty() const
+    {
+        return !root_;
+    }
+
+    bool NotEmpty() const
+    {
+        return !IsEmpty();
+    }
+
+    // Height of the chunk tree, 0 for a single chunk
+    SizeType Depth() const
+    {
+        return root_ ? root_->height : 0;
+    }
+
+public:
+    CharType operator[](const SizeType index) const
+    {
+        return __Detail::RopeTree::CharAt(root_.get(), index);
+    }
+
+    CharType At(const SizeType index) const
+    {
+        if (index >= size())
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        return (*this)[index];
+    }
+
+public:
+    Rope& operator+=(const Rope& other)
+    {
+        root_ = __Detail::RopeTree::Concat(root_, other.root_);
+        return *this;
+    }
+
+    Rope operator+(const Rope& other) const
+    {
+        return Rope{__Detail::RopeTree::Concat(root_, other.root_)};
+    }
+
+    void Append(const Rope& other)
+    {
+        *this += other;
+    }
+
+    void Insert(const SizeType pos, const Rope& other)
+    {
+        if (pos > size())
+        {
+            throw std::out_of_range("Position out of range");
+        }
+        auto parts = __Detail::RopeTree::Split(root_, pos);
+        root_ = __Detail::RopeTree::Concat(__Detail::RopeTree::Concat(parts.first, other.root_), parts.second);
+    }
+
+    void Erase(const SizeType pos, const SizeType count = NPosition)
+    {
+        if (pos > size())
+        {
+            throw std::out_of_range("Position out of range");
+        }
+        auto head = __Detail::RopeTree::Split(root_, pos);
+        auto tail = __Detail::RopeTree::Split(head.second, std::min(count, size() - pos));
+        root_ = __Detail::RopeTree::Concat(head.first, tail.second);
+    }
+
+    Rope Substring(const SizeType pos, const SizeType count = NPosition) const
+    {
+        if (pos > size())
+        {
+            throw std::out_of_range("Position out of range");
+        }
+        auto tail = __Detail::RopeTree::Split(root_, pos).second;
+        return Rope{__Detail::RopeTree::Split(tail, std::min(count, size() - pos)).first};
+    }
+
+    void Clear()
+    {
+        root_.reset();
+    }
+
+public:
+    // Calls the function with a view of every chunk in order
+    template <typename Function>
+    void ForEachChunk(Function function) const
+    {
+        auto visit = [&function](const __Detail::RopeNode& leaf)
+        { function(__Detail::MakeTrustedView(leaf.Data(), leaf.bytes, leaf.length)); };
+        __Detail::RopeTree::ForEachLeaf(root_.get(), visit);
+    }
+
+    String ToString() const
+    {
+        String result;
+        result.Reserve(ByteCount());
+        ForEachChunk([&result](const StringView& chunk) { result.Append(chunk); });
+        return result;
+    }
+
+    // Collapses the rope into a single chunk and returns a view of it, the view is valid until the rope
+    // is modified. This copies every byte into a new leaf and drops the sharing with other ropes;
+    // ToString() copies the text without changing the rope.
+    StringView View()
+    {
+        if (!root_)
+        {
+            return StringView{};
+        }
+        if (!root_->IsLeaf())
+        {
+            auto buffer = std::make_shared<std::string>();
+            buffer->reserve(root_->bytes);
+            ForEachChunk([&buffer](const StringView& chunk) { buffer->append(chunk.data(), chunk.ByteCount()); });
+            root_ = __Detail::RopeTree::MakeLeaf(std::move(buffer), 0, root_->bytes, root_->length);
+        }
+        return __Detail::MakeTrustedView(root_->Data(), root_->bytes, root_->length);
+    }
+
+public:
+    bool operator==(const StringView& other) const
+    {
+        if (ByteCount() != other.ByteCount())
+        {
+            return false;
+        }
+        SizeType offset = 0;
+        bool equal = true;
+        ForEachChunk(
+            [&](const StringView& chunk)
+            {
+                equal = equal && std::memcmp(chunk.data(), other.data() + offset, chunk.ByteCount()) == 0;
+                offset += chunk.ByteCount();
+            });
+        return equal;
+    }
+
+    bool operator!=(const StringView& other) const
+    {
+        return !(*this == other);
+    }
+
+    bool operator==(const char* other) const
+    {
+        return *this == StringView{other};
+    }
+
+    bool operator!=(const char* other) const
+    {
+        return !(*this == other);
+    }
+
+    bool operator==(const String& other) const
+    {
+        return *this == other.View();
+    }
+
+    bool operator!=(const String& other) const
+    {
+        return !(*this == other);
+    }
+
+    // Walks both chunk sequences side by side, the chunk boundaries of the ropes need not match
+    bool operator==(const Rope& other) const
+    {
+        if (root_ == other.root_)
+        {
+            return true;
+        }
+        if (ByteCount() != other.ByteCount())
+        {
+            return false;
+        }
+        std::vector<StringView> chunks;
+        other.ForEachChunk([&chunks](const StringView& chunk) { chunks.push_back(chunk); });
+
+        SizeType index = 0;
+        SizeType offset = 0;
+        bool equal = true;
+        ForEachChunk(
+            [&](const StringView& chunk)
+            {
+                SizeType done = 0;
+
+                while (equal && done < chunk.ByteCount())
+                {
+                    const StringView& current = chunks[index];
+                    const SizeType count = std::min(chunk.ByteCount() - done, current.ByteCount() - offset);
+                    equal = std::memcmp(chunk.data() + done, current.data() + offset, count) == 0;
+                    done += count;
+                    offset += count;
+
+                    if (offset == current.ByteCount())
+                    {
+                        ++index;
+                        offset = 0;
+                    }
+                }
+            });
+        return equal;
+    }
+
+    bool operator!=(const Rope& other) const
+    {
+        return !(*this == other);
+    }
+
+public:
+    static constexpr auto NPosition{static_cast<SizeType>(-1)};
+
+private:
+    explicit Rope(__Detail::RopeNode::Pointer root) : root_{std::move(root)}
+    {
+    }
+
+private:
+    __Detail::RopeNode::Pointer root_;
+};
+
+__CAITLYN_GLOBAL_NAMESPACE_END
+
+inline std::ostream& operator<<(std::ostream& os, const Caitlyn::Rope& rope)
+{
+    rope.ForEachChunk([&os](const Caitlyn::StringView& chunk) { os << chunk; });
+    return os;
+}
+
+#endif // CAITLYN_CORE_STRING_ROPE_H_
@@ -0,0 +1,88 @@
+/**
+ * This file is part of the Caitlyn library
+ * Copyright (C) 2024 Alexander Szawrowski
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CAITLYN_CORE_STRING_SIMD_H_
+#define CAITLYN_CORE_STRING_SIMD_H_
+
+#include "Caitlyn/__Base.h"
+
+#if __CAITLYN_HAS_AVX2
+    #include <immintrin.h>
+#elif __CAITLYN_HAS_SSE2
+    #include <emmintrin.h>
+#endif
+
+#if defined(__CAITLYN_COMPILER_MSVC)
+    #include <intrin.h>
+#endif
+
+__CAITLYN_GLOBAL_NAMESPACE_BEGIN
+__CAITLYN_DETAIL_NAMESPACE_BEGIN
+
+inline UInt32 PopCount(UInt32 mask)
+{
+#if defined(__CAITLYN_COMPILER_GCC) || defined(__CAITLYN_COMPILER_CLANG)
+    return static_cast<UInt32>(__builtin_popcount(mask));
+#else
+    mask = mask - ((mask >> 1) & 0x55555555);
+    mask = (mask & 0x33333333) + ((mask >> 2) & 0x33333333);
+    return (((mask + (mask >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24;
+#endif
+}
+
+// Index of the lowest set bit, the mask must not be zero
+inline UInt32 CountTrailingZeros(const UInt32 mask)
+{
+#if defined(__CAITLYN_COMPILER_GCC) || defined(__CAITLYN_COMPILER_CLANG)
+    return static_cast<UInt32>(__builtin_ctz(mask));
+#elif defined(__CAITLYN_COMPILER_MSVC)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<UInt32>(index);
+#else
+    UInt32 index = 0;
+    while ((mask >> index & 1) == 0)
+    {
+        ++index;
+    }
+    return index;
+#endif
+}
+
+// Number of zero bits above the highest set bit, the mask must not be zero
+inline UInt32 CountLeadingZeros(const UInt32 mask)
+{
+#if defined(__CAITLYN_COMPILER_GCC) || defined(__CAITLYN_COMPILER_CLANG)
+    return static_cast<UInt32>(__builtin_clz(mask));
+#elif defined(__CAITLYN_COMPILER_MSVC)
+    unsigned long index;
+    _BitScanReverse(&index, mask);
+    return static_cast<UInt32>(31 - index);
+#else
+    UInt32 count = 0;
+    while ((mask << count & 0x80000000) == 0)
+    {
+        ++count;
+    }
+    return count;
+#endif
+}
+
+__CAITLYN_DETAIL_NAMESPACE_END
+__CAITLYN_GLOBAL_NAMESPACE_END
+
+#endif // CAITLYN_CORE_STRING_SIMD_H_
@@ -0,0 +1,261 @@
+/**
+ * This file is part of the Caitlyn library
+ * Copyright (C) 2024 Alexander Szawrowski
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CAITLYN_CORE_STRING_SPLIT_H_
+#define CAITLYN_CORE_STRING_SPLIT_H_
+
+#include <cstring>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "Caitlyn/__Base.h"
+#include "Caitlyn/__Core/String/Algorithms/Search.h"
+#include "Caitlyn/__Core/String/StringView.h"
+#include "Caitlyn/__Core/String/Utf8.h"
+
+__CAITLYN_GLOBAL_NAMESPACE_BEGIN
+
+enum class SplitMode
+{
+    KeepEmpty,
+    SkipEmpty
+};
+
+__CAITLYN_DETAIL_NAMESPACE_BEGIN
+
+// Delimiter borrowed from the caller, an empty one never matches
+class SplitSequence
+{
+public:
+    explicit SplitSequence(const StringView& delimiter) : data_{delimiter.data()}, size_{delimiter.ByteCount()}
+    {
+    }
+
+    SizeType Find(const char* text, const SizeType size, const SizeType from, SizeType& length) const
+    {
+        length = size_;
+        return size_ == 0 ? NotFound : FindBytes(text, size, data_, size_, from);
+    }
+
+private:
+    const char* data_;
+    SizeType size_;
+};
+
+// Encoded code point kept inline, single bytes are found with memchr
+class SplitCodePoint
+{
+public:
+    explicit SplitCodePoint(const CodePoint codePoint) : size_{EncodeUtf8(codePoint, data_)}
+    {
+    }
+
+    SizeType Find(const char* text, const SizeType size, const SizeType from, SizeType& length) const
+    {
+        length = size_;
+        return FindBytes(text, size, data_, size_, from);
+    }
+
+private:
+    char data_[4];
+    SizeType size_;
+};
+
+// Every code point accepted by the predicate is a delimiter
+template <typename Predicate>
+class SplitPredicate
+{
+public:
+    explicit SplitPredicate(Predicate predicate) : predicate_(std::move(predicate))
+    {
+    }
+
+    SizeType Find(const char* text, const SizeType size, const SizeType from, SizeType& length) const
+    {
+        for (SizeType i = from; i < size; i += length)
+        {
+            length = Utf8SequenceLength(text[i]);
+
+            if (predicate_(length == 1 ? static_cast<CodePoint>(static_cast<Byte>(text[i])) : DecodeUtf8(text + i)))
+            {
+                return i;
+            }
+        }
+        return NotFound;
+    }
+
+private:
+    Predicate predicate_;
+};
+
+__CAITLYN_DETAIL_NAMESPACE_END
+
+// Lazy sequence of the tokens between delimiters. Tokens are views of the text, so the range
+// allocates nothing and the text and a borrowed delimiter have to outlive it. Like std::getline and
+// SplitView, empty text has no tokens and a trailing delimiter does not add an empty one.
+template <typename Delimiter>
+class SplitRange
+{
+public:
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = StringView;
+        using difference_type = PtrDiff;
+        using reference = const StringView&;
+        using pointer = const StringView*;
+
+    public:
+        Iterator() = default;
+
+        reference operator*() const
+        {
+            return token_;
+        }
+
+        pointer operator->() const
+        {
+            return &token_;
+        }
+
+        Iterator& operator++()
+        {
+            Advance();
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator copy{*this};
+            Advance();
+            return copy;
+        }
+
+        bool operator==(const Iterator& other) const
+        {
+            return first_ == other.first_;
+        }
+
+        bool operator!=(const Iterator& other) const
+        {
+            return first_ != other.first_;
+        }
+
+    private:
+        friend class SplitRange;
+
+        explicit Iterator(const SplitRange* range)
+            : range_{range}, next_{range->text_.IsEmpty() ? __Detail::NotFound : 0}
+        {
+            Advance();
+        }
+
+        void Advance()
+        {
+            const char* data = range_->text_.data();
+            const SizeType size = range_->text_.ByteCount();
+
+            do
+            {
+                if (next_ == __Detail::NotFound)
+                {
+                    first_ = __Detail::NotFound;
+                    return;
+                }
+                SizeType length = 0;
+                const SizeType found = range_->delimiter_.Find(data, size, next_, length);
+                const SizeType last = found == __Detail::NotFound ? size : found;
+
+                // A delimiter at the very end closes the last token without starting an empty one
+                first_ = next_;
+                next_ = found == __Detail::NotFound || found + length == size ? __Detail::NotFound : found + length;
+                token_ = range_->Token(first_, last);
+            }
+            while (range_->mode_ == SplitMode::SkipEmpty && token_.IsEmpty());
+        }
+
+    private:
+        const SplitRange* range_ = nullptr;
+        SizeType first_ = __Detail::NotFound;
+        SizeType next_ = __Detail::NotFound;
+        StringView token_;
+    };
+
+public:
+    SplitRange(const StringView& text, Delimiter delimiter, const SplitMode mode)
+        : text_{text}, delimiter_(std::move(delimiter)), mode_{mode}
+    {
+    }
+
+public:
+    Iterator begin() const
+    {
+        return Iterator{this};
+    }
+
+    Iterator end() const
+    {
+        return Iterator{};
+    }
+
+    std::vector<StringView> ToVector() const
+    {
+        return std::vector<StringView>(begin(), end());
+    }
+
+private:
+    StringView Token(const SizeType first, const SizeType last) const
+    {
+        const char* data = text_.data() + first;
+        const SizeType size = last - first;
+        const SizeType length = text_.IsAscii() ? size : __Detail::CountUtf8CodePoints(data, size);
+        return __Detail::MakeTrustedView(data, size, length);
+    }
+
+private:
+    StringView text_;
+    Delimiter delimiter_;
+    SplitMode mode_;
+};
+
+// Splits on every occurrence of the delimiter, an empty delimiter yields the whole text
+inline SplitRange<__Detail::SplitSequence> Split(const StringView& text, const StringView& delimiter,
+                                                 const SplitMode mode = SplitMode::KeepEmpty)
+{
+    return SplitRange<__Detail::SplitSequence>{text, __Detail::SplitSequence{delimiter}, mode};
+}
+
+inline SplitRange<__Detail::SplitCodePoint> Split(const StringView& text, const CodePoint delimiter,
+                                                  const SplitMode mode = SplitMode::KeepEmpty)
+{
+    return SplitRange<__Detail::SplitCodePoint>{text, __Detail::SplitCodePoint{delimiter}, mode};
+}
+
+// Splits on every code point the predicate accepts
+template <typename Predicate>
+SplitRange<__Detail::SplitPredicate<Predicate>> SplitIf(const StringView& text, Predicate predicate,
+                                                         const SplitMode mode = SplitMode::KeepEmpty)
+{
+    return SplitRange<__Detail::SplitPredicate<Predicate>>{
+        text, __Detail::SplitPredicate<Predicate>{std::move(predicate)}, mode};
+}
+
+__CAITLYN_GLOBAL_NAMESPACE_END
+
+#endif // CAITLYN_CORE_STRING_SPLIT_H_
@@ -0,0 +1,265 @@
+/**
+ * This file is part of the Caitlyn library
+ * Copyright (C) 2024 Alexander Szawrowski
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CAITLYN_CORE_STRING_STORAGE_H_
+#define CAITLYN_CORE_STRING_STORAGE_H_
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include "Caitlyn/__Base.h"
+
+__CAITLYN_GLOBAL_NAMESPACE_BEGIN
+__CAITLYN_DETAIL_NAMESPACE_BEGIN
+
+// Null-terminated byte buffer that keeps up to InlineCapacity bytes without a heap allocation
+class StringStorage
+{
+public:
+    static constexpr SizeType InlineCapacity = 23;
+
+public:
+    StringStorage() noexcept : size_{0}, inline_{}
+    {
+    }
+
+    StringStorage(const char* bytes, const SizeType count) : StringStorage()
+    {
+        Append(bytes, count);
+    }
+
+    StringStorage(const StringStorage& other) : StringStorage()
+    {
+        Append(other.Data(), other.Size());
+    }
+
+    // Takes over the representation, the heap members or the inline bytes, and leaves other empty
+    StringStorage(StringStorage&& other) noexcept : size_{other.size_}
+    {
+        std::memcpy(inline_, other.inline_, sizeof(inline_));
+        other.size_ = 0;
+        other.inline_[0] = '\0';
+    }
+
+    StringStorage& operator=(const StringStorage& other)
+    {
+        if (this != &other)
+        {
+            Clear();
+            Append(other.Data(), other.Size());
+        }
+        return *this;
+    }
+
+    StringStorage& operator=(StringStorage&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Swap(other);
+            other.Clear();
+        }
+        return *this;
+    }
+
+    ~StringStorage()
+    {
+        if (IsHeap())
+        {
+            delete[] heap_.data;
+        }
+    }
+
+public:
+    const char* Data() const
+    {
+        return IsHeap() ? heap_.data : inline_;
+    }
+
+    char* Data()
+    {
+        return IsHeap() ? heap_.data : inline_;
+    }
+
+    SizeType Size() const
+    {
+        return size_ & ~HeapFlag;
+    }
+
+    SizeType Capacity() const
+    {
+        return IsHeap() ? heap_.capacity : InlineCapacity;
+    }
+
+    bool IsEmpty() const
+    {
+        return Size() == 0;
+    }
+
+    bool IsInline() const
+    {
+        return !IsHeap();
+    }
+
+public:
+    void Reserve(const SizeType capacity)
+    {
+        if (capacity > Capacity())
+        {
+            Reallocate(capacity);
+        }
+    }
+
+    // Bytes past the old size are left uninitialized
+    void Resize(const SizeType size)
+    {
+        Grow(size);
+        SetSize(size);
+    }
+
+    void Append(const char* bytes, const SizeType count)
+    {
+        Replace(Size(), 0, bytes, count);
+    }
+
+    void Append(const SizeType count, const char byte)
+    {
+        const SizeType size = Size();
+        std::memset(Grow(size + count) + size, byte, count);
+        SetSize(size + count);
+    }
+
+    void Insert(const SizeType offset, const char* bytes, const SizeType count)
+    {
+        Replace(offset, 0, bytes, count);
+    }
+
+    void Erase(const SizeType offset, const SizeType count)
+    {
+        Replace(offset, count, nullptr, 0);
+    }
+
+    // Replaces count bytes at the offset with the given bytes, which may point into this buffer
+    void Replace(const SizeType offset, const SizeType count, const char* bytes, const SizeType bytes_count)
+    {
+        const SizeType size = Size();
+
+        if (bytes_count != 0 && bytes >= Data() && bytes < Data() + size)
+        {
+            const std::basic_string<char> copy(bytes, bytes_count);
+            Replace(offset, count, copy.data(), copy.size());
+            return;
+        }
+        const SizeType new_size = size - count + bytes_count;
+        char* data = Grow(new_size);
+        std::memmove(data + offset + bytes_count, data + offset + count, size - offset - count);
+        if (bytes_count != 0)
+        {
+            std::memcpy(data + offset, bytes, bytes_count);
+        }
+        SetSize(new_size);
+    }
+
+    void Clear()
+    {
+        SetSize(0);
+    }
+
+    void Swap(StringStorage& other) noexcept
+    {
+        char representation[sizeof(inline_)];
+        std::memcpy(representation, inline_, sizeof(inline_)); // covers the heap members as well
+        std::memcpy(inline_, other.inline_, sizeof(inline_));
+        std::memcpy(other.inline_, representation, sizeof(inline_));
+        std::swap(size_, other.size_);
+    }
+
+    // Lexicographic comparison of the bytes as unsigned values
+    int Compare(const char* bytes, const SizeType count) const
+    {
+        const SizeType size = Size();
+        const int result = std::memcmp(Data(), bytes, std::min(size, count));
+
+        if (result != 0)
+        {
+            return result;
+        }
+        return size < count ? -1 : (size > count ? 1 : 0);
+    }
+
+private:
+    static constexpr SizeType HeapFlag = ~(static_cast<SizeType>(-1) >> 1);
+
+    bool IsHeap() const
+    {
+        return (size_ & HeapFlag) != 0;
+    }
+
+    void SetSize(const SizeType size)
+    {
+        size_ = size | (size_ & HeapFlag);
+        Data()[size] = '\0';
+    }
+
+    // Returns the buffer, a new allocation is handed back directly rather than through Data()
+    char* Grow(const SizeType size)
+    {
+        if (size > Capacity())
+        {
+            return Reallocate(std::max(size, Capacity() * 2));
+        }
+        return Data();
+    }
+
+    char* Reallocate(const SizeType capacity)
+    {
+        const SizeType size = Size();
+        char* data = new char[capacity + 1];
+        std::memcpy(data, Data(), size + 1);
+
+        if (IsHeap())
+        {
+            delete[] heap_.data;
+        }
+        heap_.data = data;
+        heap_.capacity = capacity;
+        size_ = size | HeapFlag;
+        return data;
+    }
+
+private:
+    struct Heap
+    {
+        char* data;
+        SizeType capacity;
+    };
+
+    SizeType size_;
+
+    union
+    {
+        Heap heap_;
+        char inline_[InlineCapacity + 1];
+    };
+
+    static_assert(sizeof(Heap) <= InlineCapacity + 1, "Inline buffer must overlay the heap members");
+};
+
+__CAITLYN_DETAIL_NAMESPACE_END
+__CAITLYN_GLOBAL_NAMESPACE_END
+
+#endif // CAITLYN_CORE_STRING_STORAGE_H_
@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <bitset>
+#include <cstring>
 #include <iterator>
 #include <sstream>
 #include <stdexcept>
@@ -29,6 +30,16 @@
 
 #include "Caitlyn/__Base.h"
 #include "Caitlyn/__Core/Char.h"
+#include "Caitlyn/__Core/String/Algorithms/Search.h"
+#include "Caitlyn/__Core/String/Ascii.h"
+#include "Caitlyn/__Core/String/Format.h"
+#include "Caitlyn/__Core/String/FormatString.h"
+#include "Caitlyn/__Core/String/Hash.h"
+#include "Caitlyn/__Core/String/Index.h"
+#include "Caitlyn/__Core/String/Iterator.h"
+#include "Caitlyn/__Core/String/Storage.h"
+#include "Caitlyn/__Core/String/StringView.h"
+#include "Caitlyn/__Core/String/Utf8.h"
 #include "Caitlyn/__Core/Traits/Constraints/String.h"
 #include "Caitlyn/__Core/Traits/Types/Base.h"
 #include "Caitlyn/__Core/Traits/Types/Primary.h"
@@ -36,85 +47,91 @@
 
 __CAITLYN_GLOBAL_NAMESPACE_BEGIN
 
+// UTF-8 string stored as a contiguous byte buffer, code points are decoded on access
 class String
 {
 public:
     using ValueType = char;
     using CharType = Char;
-    using DataType = std::vector<CharType>;
     using BasicString = std::basic_string<ValueType>;
-    using DifferenceType = DataType::difference_type;
-    using Iterator = DataType::iterator;
-    using ConstIterator = DataType::const_iterator;
-    using ReverseIterator = DataType::reverse_iterator;
-    using ConstReverseIterator = DataType::const_reverse_iterator;
+    using DataType = __Detail::StringStorage;
+    using DifferenceType = PtrDiff;
+    using Reference = __Detail::StringCharReference<String>;
+    using Iterator = __Detail::StringIterator<String, false>;
+    using ConstIterator = __Detail::StringConstIterator<String, false>;
+    using ReverseIterator = __Detail::StringIterator<String, true>;
+    using ConstReverseIterator = __Detail::StringConstIterator<String, true>;
+
+    // Former nested names of the formatting error, Caitlyn::FormatError is thrown
+    using FormatError = Caitlyn::FormatError;
+
+    struct Formatter
+    {
+        using FormatError = Caitlyn::FormatError;
+    };
 
 public:
     String() = default;
 
     String(const char* str)
     {
-        while (*str)
-        {
-            data_.emplace_back(DecodeUtf8Char(str));
-            // Move past the current UTF-8 character
-            str += DecodeUtf8Char(str).size();
-        }
+        Append(str);
     }
 
     // Constructor from basic_string
     String(const BasicString& str)
     {
-        const char* cstr = str.c_str();
-        while (*cstr)
-        {
-            data_.emplace_back(DecodeUtf8Char(cstr));
-            // Move past the current UTF-8 character
-            cstr += DecodeUtf8Char(cstr).size();
-        }
+        AppendBytes(str.data(), str.size());
+    }
+
+    // Constructor from a view, copies the viewed bytes
+    explicit String(const StringView& view) : data_(view.data(), view.ByteCount()), length_(view.Length())
+    {
     }
 
     // Constructor from std::vector<character>
-    String(const std::vector<CharType>& chars) : data_(chars)
+    String(const std::vector<CharType>& chars)
     {
+        for (const auto& ch : chars)
+        {
+            PushBack(ch);
+        }
     }
 
     // Constructor from SizeType and char
     String(const SizeType count, const char ch)
     {
-        for (SizeType i = 0; i < count; ++i)
-        {
-            data_.emplace_back(BasicString(1, ch));
-        }
+        Append(count, CharType{BasicString(1, ch)});
     }
 
     String(const SizeType count, const Char& ch)
     {
-        for (SizeType i = 0; i < count; ++i)
-        {
-            data_.emplace_back(ch);
-        }
+        Append(count, ch);
     }
 
     // Constructor from iterator range
     template <typename InputIt>
     String(InputIt first, InputIt last)
     {
-        while (first != last)
+        BasicString bytes;
+
+        for (; first != last; ++first)
         {
-            data_.emplace_back(decode_utf8_char(&(*first)));
-            ++first;
+            AppendElement(bytes, *first);
         }
+        AppendBytes(bytes.data(), bytes.size());
     }
 
     // Copy constructor
-    String(const String& other) : data_(other.data_)
+    String(const String& other) : data_(other.data_), length_(other.length_)
     {
     }
 
     // Move constructor
-    String(String&& other) noexcept : data_(std::move(other.data_))
+    String(String&& other) noexcept
+        : data_(std::move(other.data_)), length_(other.length_), index_(std::move(other.index_))
     {
+        other.length_ = 0;
     }
 
     // Copy assignment operator
@@ -123,6 +140,8 @@ public:
         if (this != &other)
         {
             data_ = other.data_;
+            length_ = other.length_;
+            index_.Reset();
         }
         return *this;
     }
@@ -133,6 +152,9 @@ public:
         if (this != &other)
         {
             data_ = std::move(other.data_);
+            length_ = other.length_;
+            index_ = std::move(other.index_);
+            other.length_ = 0;
         }
         return *this;
     }
@@ -141,220 +163,290 @@ public:
     // Size
     SizeType size() const
     {
-        return data_.size();
+        return length_;
     }
 
     SizeType Length() const
     {
-        return data_.size();
+        return length_;
     }
 
-    const CharType& operator[](const SizeType index) const
+    CharType operator[](const SizeType index) const
     {
-        return data_[index];
+        return CharAt(ByteOffset(index));
     }
 
-    CharType& operator[](const SizeType index)
+    Reference operator[](const SizeType index)
     {
-        return data_[index];
+        return Reference{this, ByteOffset(index)};
     }
 
-    const CharType& At(const SizeType index) const
+    CharType At(const SizeType index) const
     {
         if (index >= size())
         {
             throw std::out_of_range("Index out of range");
         }
-        return data_[index];
+        return CharAt(ByteOffset(index));
     }
 
-    CharType& At(const SizeType idx)
+    Reference At(const SizeType idx)
     {
         if (idx >= size())
         {
             throw std::out_of_range("Index out of range");
         }
-        return data_[idx];
+        return Reference{this, ByteOffset(idx)};
     }
 
 public:
     Iterator begin()
     {
-        return data_.begin();
+        return Iterator{this, 0};
     }
 
     Iterator end()
     {
-        return data_.end();
+        return Iterator{this, ByteCount()};
     }
 
     ConstIterator begin() const
     {
-        return data_.begin();
+        return ConstIterator{this, 0};
     }
 
     ConstIterator end() const
     {
-        return data_.end();
+        return ConstIterator{this, ByteCount()};
     }
 
     ReverseIterator rbegin()
     {
-        return data_.rbegin();
+        return ++ReverseIterator{this, ByteCount()};
     }
 
     ReverseIterator rend()
     {
-        return data_.rend();
+        return ReverseIterator{this, NPosition};
     }
 
     ConstReverseIterator rbegin() const
     {
-        return data_.rbegin();
+        return ++ConstReverseIterator{this, ByteCount()};
     }
 
     ConstReverseIterator rend() const
     {
-        return data_.rend();
+        return ConstReverseIterator{this, NPosition};
     }
 
     ConstIterator cbegin() const
     {
-        return data_.cbegin();
+        return begin();
     }
 
     ConstIterator cend() const
     {
-        return data_.cend();
+        return end();
     }
 
     ConstReverseIterator crbegin() const
     {
-        return data_.crbegin();
+        return rbegin();
     }
 
     ConstReverseIterator crend() const
     {
-        return data_.crend();
+        return rend();
     }
 
 public:
     String& operator+=(const String& str)
     {
-        data_.insert(data_.end(), str.data_.begin(), str.data_.end());
+        data_.Append(str.data(), str.ByteCount());
+        length_ += str.length_;
+        index_.Reset();
         return *this;
     }
 
-    String operator+(const String& str) const
+    // Append character
+    void PushBack(const CharType& c)
     {
-        DataType ret(data_.size() + str.data_.size());
-        SizeType pos = 0;
+        data_.Append(c.data(), c.size());
+        length_ += c.IsEmpty() ? 0 : 1;
+        index_.Reset();
+    }
 
-        for (; pos < data_.size(); ++pos)
-        {
-            ret[pos] = data_[pos];
-        }
-        for (SizeType i = 0; i < str.data_.size(); ++i)
-        {
-            ret[pos + i] = str.data_[i];
-        }
-        return String{ret};
+    void Append(const char* cstr)
+    {
+        AppendBytes(cstr, std::strlen(cstr));
     }
 
-    // Append character
-    void PushBack(const CharType& c)
+    void Append(const StringView& view)
     {
-        data_.push_back(c);
+        data_.Append(view.data(), view.ByteCount());
+        length_ += view.Length();
+        index_.Reset();
     }
 
-    void Append(const char* cstr)
+    // Inserts the text in front of the existing bytes
+    void Prepend(const StringView& view)
     {
-        while (*cstr)
-        {
-            data_.emplace_back(DecodeUtf8Char(cstr));
-            // Move past the current UTF-8 character
-            cstr += DecodeUtf8Char(cstr).size();
-        }
+        data_.Insert(0, view.data(), view.ByteCount());
+        length_ += view.Length();
+        index_.Reset();
+    }
+
+    // Reserves storage for the given number of bytes
+    void Reserve(const SizeType bytes)
+    {
+        data_.Reserve(bytes);
+    }
+
+    // Number of bytes the storage holds without growing
+    SizeType Capacity() const
+    {
+        return data_.Capacity();
     }
 
     void Append(const SizeType count, const char* pattern)
     {
-        SizeType i = 0;
-        while (i < count)
-        {
-            data_.emplace_back(pattern);
-            ++i;
-        }
+        Append(count, CharType{pattern});
     }
 
     void Append(const SizeType count, const CharType& pattern)
     {
-        SizeType i = 0;
-        while (i < count)
+        if (pattern.size() == 1)
+        {
+            data_.Append(count, *pattern.data());
+        }
+        else
         {
-            data_.emplace_back(pattern);
-            ++i;
+            // Resize grows the storage geometrically, the new bytes are filled in place
+            const SizeType offset = ByteCount();
+            data_.Resize(offset + count * pattern.size());
+            char* output = data_.Data() + offset;
+
+            for (SizeType i = 0; i < count; ++i, output += pattern.size())
+            {
+                std::memcpy(output, pattern.data(), pattern.size());
+            }
         }
+        length_ += pattern.IsEmpty() ? 0 : count;
+        index_.Reset();
     }
 
     void Clear()
     {
-        data_.clear();
+        data_.Clear();
+        length_ = 0;
+        index_.Reset();
+    }
+
+    // Lexicographic comparison of the bytes, which matches code point order
+    int Compare(const String& other) const
+    {
+        return data_.Compare(other.data(), other.ByteCount());
+    }
+
+    int Compare(const StringView& other) const
+    {
+        return data_.Compare(other.data(), other.ByteCount());
+    }
+
+    int Compare(const BasicString& other) const
+    {
+        return data_.Compare(other.data(), other.size());
+    }
+
+    int Compare(const char* other) const
+    {
+        return data_.Compare(other, std::strlen(other));
     }
 
     bool operator>(const char* other) const
     {
-        return str() > other;
+        return Compare(other) > 0;
     }
 
     bool operator<(const char* other) const
     {
-        return str() < other;
+        return Compare(other) < 0;
     }
 
     bool operator>=(const char* other) const
     {
-        return str() >= other;
+        return Compare(other) >= 0;
     }
 
     bool operator<=(const char* other) const
     {
-        return str() <= other;
+        return Compare(other) <= 0;
     }
 
     bool operator==(const char* other) const
     {
-        return str() == other;
+        return std::strlen(other) == ByteCount() && std::memcmp(data(), other, ByteCount()) == 0;
     }
 
     bool operator!=(const char* other) const
     {
-        return str() != other;
+        return !(*this == other);
+    }
+
+    bool operator>(const BasicString& other) const
+    {
+        return Compare(other) > 0;
+    }
+
+    bool operator<(const BasicString& other) const
+    {
+        return Compare(other) < 0;
+    }
+
+    bool operator>=(const BasicString& other) const
+    {
+        return Compare(other) >= 0;
+    }
+
+    bool operator<=(const BasicString& other) const
+    {
+        return Compare(other) <= 0;
+    }
+
+    bool operator==(const BasicString& other) const
+    {
+        return other.size() == ByteCount() && std::memcmp(data(), other.data(), ByteCount()) == 0;
+    }
+
+    bool operator!=(const BasicString& other) const
+    {
+        return !(*this == other);
     }
 
     bool operator>(const String& other) const
     {
-        return data_ > other.data_;
+        return Compare(other) > 0;
     }
 
     bool operator<(const String& other) const
     {
-        return data_ < other.data_;
+        return Compare(other) < 0;
     }
 
     bool operator>=(const String& other) const
     {
-        return data_ >= other.data_;
+        return Compare(other) >= 0;
     }
 
     bool operator<=(const String& other) const
     {
-        return data_ <= other.data_;
+        return Compare(other) <= 0;
     }
 
     bool operator==(const String& other) const
     {
-        return data_ == other.data_;
+        return ByteCount() == other.ByteCount() && std::memcmp(data(), other.data(), ByteCount()) == 0;
     }
 
     bool operator!=(const String& other) const
@@ -362,57 +454,58 @@ public:
         return !(*this == other);
     }
 
+    bool operator==(const StringView& other) const
+    {
+        return View() == other;
+    }
+
+    bool operator!=(const StringView& other) const
+    {
+        return View() != other;
+    }
+
     // Method to check if the string starts with a given prefix
-    bool StartsWith(const String& prefix) const
+    bool StartsWith(const StringView& prefix) const
     {
-        if (prefix.size() > size())
-        {
-            return false;
-        }
-        return std::equal(prefix.begin(), prefix.end(), data_.begin());
+        return prefix.ByteCount() <= ByteCount() && std::memcmp(data(), prefix.data(), prefix.ByteCount()) == 0;
     }
 
     // Method to check if the string ends with a given suffix
-    bool EndsWith(const String& suffix) const
+    bool EndsWith(const StringView& suffix) const
     {
-        if (suffix.size() > size())
-        {
-            return false;
-        }
-        return std::equal(suffix.rbegin(), suffix.rend(), data_.rbegin());
+        return suffix.ByteCount() <= ByteCount() &&
+               std::memcmp(data() + ByteCount() - suffix.ByteCount(), suffix.data(), suffix.ByteCount()) == 0;
     }
 
     // Method to check if the string contains a given substring
-    bool Contains(const String& substring) const
+    bool Contains(const StringView& substring) const
     {
-        return std::search(data_.begin(), data_.end(), substring.begin(), substring.end()) != data_.end();
+        return __Detail::FindBytes(data(), ByteCount(), substring.data(), substring.ByteCount()) !=
+               __Detail::NotFound;
     }
 
     // Method to find the first occurrence of a substring
-    SizeType Find(const String& substr, const SizeType pos = 0) const
+    SizeType Find(const StringView& substr, const SizeType pos = 0) const
     {
-        const auto it =
-            std::search(data_.begin() + static_cast<DifferenceType>(pos), data_.end(), substr.begin(), substr.end());
-        return (it != data_.end()) ? std::distance(data_.begin(), it) : NPosition;
+        if (pos > size())
+        {
+            return NPosition;
+        }
+        const auto offset =
+            __Detail::FindBytes(data(), ByteCount(), substr.data(), substr.ByteCount(), ByteOffset(pos));
+        return offset != __Detail::NotFound ? CodePointIndex(offset) : NPosition;
     }
 
-    // Method to find the last occurrence of a substring
-    SizeType ReverseFind(const String& substr, SizeType pos = NPosition) const
+    // Method to find the last occurrence of a substring starting at or before the position
+    SizeType ReverseFind(const StringView& substr, const SizeType pos = NPosition) const
     {
         if (substr.size() > size())
         {
             return NPosition;
         }
-        if (pos >= size())
-        {
-            pos = size() - 1;
-        }
-        const auto it = std::search(
-            data_.rbegin() + static_cast<DifferenceType>(size() - pos - 1),
-            data_.rend(),
-            substr.rbegin(),
-            substr.rend());
-        return (it != data_.rend()) ? size() - 1 - std::distance(data_.rbegin(), it) : NPosition;
+        const auto from = pos >= size() ? __Detail::NotFound : ByteOffset(pos);
+        const auto offset = __Detail::ReverseFindBytes(data(), ByteCount(), substr.data(), substr.ByteCount(), from);
+        return offset != __Detail::NotFound ? CodePointIndex(offset) : NPosition;
     }
 
     // Substring method
@@ -422,79 +515,108 @@ public:
         {
             throw std::out_of_range("Position out of range");
         }
-        return String{std::vector<CharType>(
-            data_.begin() + static_cast<DifferenceType>(pos),
-            data_.begin() + static_cast<DifferenceType>(pos + std::min(count, size() - pos)))};
+        const SizeType length = std::min(count, size() - pos);
+        const SizeType first = ByteOffset(pos);
+        const SizeType last = ByteOffset(pos + length);
+
+        String result;
+        result.data_.Append(data() + first, last - first);
+        result.length_ = length;
+        return result;
     }
 
-    // Byte count method
-    SizeType ByteCount() const
+    // Substring that borrows the bytes of this string instead of copying them
+    StringView SubstringView(const SizeType pos, const SizeType count = NPosition) const
     {
-        SizeType count = 0;
-        for (const auto& ch : data_)
+        if (pos > size())
         {
-            count += ch.size();
+            throw std::out_of_range("Position out of range");
         }
-        return count;
+        const SizeType length = std::min(count, size() - pos);
+        const SizeType first = ByteOffset(pos);
+        return __Detail::MakeTrustedView(data() + first, ByteOffset(pos + length) - first, length);
+    }
+
+    StringView View() const
+    {
+        return __Detail::MakeTrustedView(data(), ByteCount(), length_);
+    }
+
+    operator StringView() const
+    {
+        return View();
+    }
+
+    // Byte count method
+    SizeType ByteCount() const
+    {
+        return data_.Size();
     }
 
     // Find_if method
     template <typename Predicate>
     SizeType FindIf(Predicate pred, const SizeType pos = 0) const
     {
-        auto it = std::find_if(data_.begin() + static_cast<DifferenceType>(pos), data_.end(), pred);
-        return (it != data_.end()) ? std::distance(data_.begin(), it) : NPosition;
+        SizeType index = pos;
+
+        for (auto it = ConstIterator{this, ByteOffset(pos)}; it != end(); ++it, ++index)
+        {
+            if (pred(*it))
+            {
+                return index;
+            }
+        }
+        return NPosition;
     }
 
     // Find_if_not method
     template <typename Predicate>
     SizeType FindIfNot(Predicate pred, const SizeType pos = 0) const
     {
-        auto it = std::find_if_not(data_.begin() + static_cast<DifferenceType>(pos), data_.end(), pred);
-        return (it != data_.end()) ? std::distance(data_.begin(), it) : NPosition;
+        SizeType index = pos;
+
+        for (auto it = ConstIterator{this, ByteOffset(pos)}; it != end(); ++it, ++index)
+        {
+            if (!pred(*it))
+            {
+                return index;
+            }
+        }
+        return NPosition;
     }
 
 public:
     bool IsEmpty() const
     {
-        return data_.empty();
+        return data_.IsEmpty();
     }
 
     bool NotEmpty() const
     {
-        return !data_.empty();
+        return !data_.IsEmpty();
     }
 
-    DataType data() const
+    // Checks whether every code point is encoded with a single byte
+    bool IsAscii() const
     {
-        return data_;
+        return length_ == data_.Size();
     }
 
-    std::basic_string<char> str() const
+    // Pointer to the UTF-8 encoded bytes
+    const ValueType* data() const
     {
-        std::ostringstream oss;
+        return data_.Data();
+    }
 
-        for (const auto& elem : data_)
-        {
-            oss << elem.data();
-        }
-        return oss.str();
+    BasicString str() const
+    {
+        return BasicString(data(), ByteCount());
     }
 
     // Insert method
     void Insert(const SizeType pos, const char* cstr)
     {
-        if (pos > size())
-        {
-            throw std::out_of_range("Position out of range");
-        }
-        DataType temp_data;
-        while (*cstr)
-        {
-            temp_data.emplace_back(DecodeUtf8Char(cstr));
-            cstr += DecodeUtf8Char(cstr).size();
-        }
-        data_.insert(data_.begin() + static_cast<DifferenceType>(pos), temp_data.begin(), temp_data.end());
+        Insert(pos, String{cstr});
     }
 
     void Insert(const SizeType pos, const String& str)
@@ -503,7 +625,9 @@ public:
         {
             throw std::out_of_range("Position out of range");
         }
-        data_.insert(data_.begin() + static_cast<DifferenceType>(pos), str.data_.begin(), str.data_.end());
+        data_.Insert(ByteOffset(pos), str.data(), str.ByteCount());
+        length_ += str.length_;
+        index_.Reset();
     }
 
     void Insert(const SizeType pos, const SizeType count, const CharType& ch)
@@ -512,28 +636,18 @@ public:
         {
             throw std::out_of_range("Position out of range");
         }
-        data_.insert(data_.begin() + static_cast<DifferenceType>(pos), count, ch);
+        Insert(pos, String{count, ch});
     }
 
 public:
     String ToUppercase() const
     {
-        auto tmp = data_;
-        for (auto& elem : tmp)
-        {
-            elem = ::Caitlyn::ToUppercase(elem.GetCodePoint());
-        }
-        return tmp;
+        return ConvertCase(__Detail::AsciiToUppercase, ::Caitlyn::ToUppercase);
     }
 
     String ToLowercase() const
     {
-        auto tmp = data_;
-        for (auto& elem : tmp)
-        {
-            elem = ::Caitlyn::ToLowercase(elem.GetCodePoint());
-        }
-        return tmp;
+        return ConvertCase(__Detail::AsciiToLowercase, ::Caitlyn::ToLowercase);
     }
 
 public:
@@ -560,454 +674,330 @@ public:
 
 public:
     template <typename... Args>
-    static String Format(const String& formatter, Args&&... args)
+    static String Format(const __Detail::FormatPattern& format, const Args&... args)
     {
-        const std::vector<String> arguments{Formatter::ToString(std::forward<Args>(args))...};
-
-        std::ostringstream result;
-        SizeType auto_index = 0;
-        SizeType pos = 0;
+        String result;
+        result.AppendFormat(format, args...);
+        return result;
+    }
 
-        while (pos < formatter.size())
-        {
-            if (formatter[pos] == Def::LeftCurlyBracket)
-            {
-                if (pos + 1 < formatter.size() && formatter[pos + 1] == Def::LeftCurlyBracket)
-                {
-                    result << Def::LeftCurlyBracket;
-                    pos += 2;
-                }
-                else
-                {
-                    const SizeType end = formatter.Find(Def::RightCurlyBracket, pos);
-                    if (end == String::NPosition)
-                    {
-                        throw Formatter::FormatError{"Mismatched braces in format string"};
-                    }
-                    const auto spec = formatter.Substring(pos + 1, end - pos - 1);
-                    SizeType arg_index = 0;
-                    constexpr SizeType spec_begin = 0;
-
-                    if (spec.NotEmpty() && IsDigit(spec[spec_begin].GetCodePoint()))
-                    {
-                        SizeType index_end = spec_begin;
-                        while (index_end < spec.size() && IsDigit(spec[index_end].GetCodePoint()))
-                        {
-                            ++index_end;
-                        }
-                        try
-                        {
-                            arg_index = std::stoul(spec.Substring(spec_begin, index_end - spec_begin).str());
-                        }
-                        catch (const std::out_of_range&)
-                        {
-                            throw Formatter::FormatError{"Invalid argument index"};
-                        }
-                        if (arg_index > arguments.size() - 1)
-                        {
-                            throw Formatter::FormatError{"Argument index out of range"};
-                        }
-                        auto format_spec = spec.Substring(index_end);
-
-                        if (!format_spec.IsEmpty())
-                        {
-                            if (format_spec[0] == Def::Colon)
-                            {
-                                auto parsed_spec = Formatter::MakeSpacifier(format_spec);
-                                result << Formatter::Process(arguments[auto_index], parsed_spec).str();
-                            }
-                        }
-                        else
-                        {
-                            result << arguments[arg_index].str();
-                        }
-                    }
-                    else if (spec.NotEmpty() && spec[spec_begin] == Def::Colon)
-                    {
-                        auto parsed_spec = Formatter::MakeSpacifier(spec);
-                        result << Formatter::Process(arguments[arg_index], parsed_spec).str();
-                    }
-                    else if (arguments.size() == 1)
-                    {
-                        result << arguments[0].str();
-                    }
-                    else if (arguments.size() > 1)
-                    {
-                        result << arguments[auto_index++].str();
-                    }
-                    else
-                    {
-                        throw Formatter::FormatError{"Missing argument index in format string"};
-                    }
-                    pos = end + 1;
-                }
-            }
-            else if (formatter[pos] == Def::RightCurlyBracket)
-            {
-                if (pos + 1 < formatter.size() && formatter[pos + 1] == Def::RightCurlyBracket)
-                {
-                    result << Def::RightCurlyBracket;
-                    pos += 2;
-                }
-                else
-                {
-                    throw Formatter::FormatError{"Single right curly bracket in format string"};
-                }
-            }
-            else
-            {
-                result << formatter[pos++];
-            }
-        }
-        return result.str();
+    // Formats straight into the end of the string
+    template <typename... Args>
+    void AppendFormat(const __Detail::FormatPattern& format, const Args&... args)
+    {
+        FormatSink sink{*this};
+        FormatTo(sink, format, args...);
+        sink.Finish();
     }
 
 private:
-    struct Formatter
+    // Window over the spare capacity of the string, the string is left unchanged if formatting throws
+    class FormatSink final : public FormatBuffer
     {
-        enum class Alignment
-        {
-            Left,
-            Right,
-            Center,
-        };
-
-        enum class ValueType
+    public:
+        explicit FormatSink(String& output) : FormatBuffer(nullptr, 0), output_(output), begin_{output.ByteCount()}
         {
-            String,
-            Integral,
-            Floating,
-        };
+            Window(begin_);
+        }
 
-        enum class Representation
-        {
-            Default,
-            Binary,
-            BinaryPrefixed,
-            Octal,
-            OctalPrefixed,
-            Hex,
-            HexPrefixed,
-        };
-
-        struct FormatSpecifier
-        {
-            Alignment align = Alignment::Left;
-            SizeType width = 0;
-            Char fill = Def::Space;
-            Representation repr = Representation::Default;
-            ValueType type = ValueType::String;
-            Int32 precision = -1;
-        };
-
-        class FormatError final : public std::runtime_error
+        ~FormatSink() override
         {
-        public:
-            explicit FormatError(const String& message) : std::runtime_error(message.str())
+            if (!finished_)
             {
+                output_.data_.Resize(begin_);
             }
-        };
+        }
 
     public:
-        static String ToString(const String& value)
+        void Finish()
         {
-            return String{value};
+            const SizeType end = offset_ + size_;
+            output_.data_.Resize(end);
+            output_.length_ += __Detail::CountUtf8CodePoints(output_.data() + begin_, end - begin_);
+            output_.index_.Reset();
+            finished_ = true;
         }
 
-        template <typename T>
-        static Required<IsInteger<T>(), String> ToString(const T& value)
+    private:
+        void Flush(const SizeType pending) override
         {
-            return std::to_string(value);
+            const SizeType end = offset_ + size_;
+            output_.data_.Resize(end);
+            output_.data_.Reserve(std::max(end + pending, output_.data_.Capacity() * 2));
+            Window(end);
         }
 
-        template <typename T>
-        static Required<IsFloating<T>(), String> ToString(const T& value)
+        void Window(const SizeType offset)
         {
-            return std::to_string(value);
+            offset_ = offset;
+            data_ = output_.data_.Data() + offset;
+            size_ = 0;
+            capacity_ = output_.data_.Capacity() - offset;
         }
 
-        template <typename T>
-        static Required<IsCharacter<T>(), String> ToString(const T& value)
-        {
-            return std::to_string(value);
-        }
+    private:
+        String& output_;
+        SizeType begin_;
+        SizeType offset_ = 0;
+        bool finished_ = false;
+    };
 
-        template <typename T>
-        static Required<IsBoolean<T>(), String> ToString(const T& value)
-        {
-            return String::ValueOf(value);
-        }
+private:
+    template <typename>
+    friend class __Detail::StringCharReference;
 
-        template <typename T>
-        static Required<HasToString<T>(), String> ToString(const T& value)
-        {
-            return value.to_string();
-        }
+    template <typename, bool>
+    friend class __Detail::StringConstIterator;
 
-        template <typename T>
-        static Required<HasStr<T>(), String> ToString(const T& value)
-        {
-            return value.str();
-        }
+    // Validates and appends raw UTF-8 bytes
+    void AppendBytes(const char* bytes, const SizeType count)
+    {
+        length_ += __Detail::ValidateUtf8(bytes, count);
+        data_.Append(bytes, count);
+        index_.Reset();
+    }
 
-        template <typename T>
-        static Required<ConvertibleToString<T>(), String> ToString(const T& value)
-        {
-            return value.ToString();
-        }
+    static void AppendElement(BasicString& bytes, const char byte)
+    {
+        bytes.push_back(byte);
+    }
 
-    public:
-        static void SetFill(const String& config, FormatSpecifier& spec, SizeType& pos)
+    static void AppendElement(BasicString& bytes, const CharType& ch)
+    {
+        bytes.append(ch.data(), ch.size());
+    }
+
+    // Byte offset of the code point with the given index
+    SizeType ByteOffset(const SizeType index) const
+    {
+        if (IsAscii() || index == 0)
         {
-            spec.fill = config[pos++];
+            return std::min(index, ByteCount());
         }
-
-        static void ParseAlignment(const String& config, FormatSpecifier& spec, SizeType& pos)
+        if (index >= length_)
         {
-            if (pos + 1 < config.size() &&
-                (config[pos + 1] == Def::LessThanSign || config[pos + 1] == Def::GreaterThanSign ||
-                 config[pos + 1] == Def::CircumflexAccent))
-            {
-                SetFill(config, spec, pos);
-
-                if (config[pos] == Def::LessThanSign)
-                {
-                    spec.align = Alignment::Left;
-                    ++pos;
-                }
-                else if (config[pos] == Def::GreaterThanSign)
-                {
-                    spec.align = Alignment::Right;
-                    ++pos;
-                }
-                else if (config[pos] == Def::CircumflexAccent)
-                {
-                    spec.align = Alignment::Center;
-                    ++pos;
-                }
-            }
-            else if (config[pos] == Def::LessThanSign)
-            {
-                spec.align = Alignment::Left;
-                ++pos;
-            }
-            else if (config[pos] == Def::GreaterThanSign)
-            {
-                spec.align = Alignment::Right;
-                ++pos;
-            }
-            else if (config[pos] == Def::CircumflexAccent)
-            {
-                spec.align = Alignment::Center;
-                ++pos;
-            }
+            return ByteCount();
         }
-
-        static void ParseWidth(const String& config, FormatSpecifier& spec, SizeType& pos)
+        if (length_ <= __Detail::StringIndex::Stride)
         {
-            if (pos < config.size() && IsDigit(config[pos].GetCodePoint()))
-            {
-                spec.width = std::stoul(config.Substring(pos).str());
-                while (pos < config.size() && IsDigit(config[pos].GetCodePoint()))
-                {
-                    ++pos;
-                }
-            }
+            return __Detail::Utf8ByteOffset(data(), ByteCount(), index);
         }
+        return index_.ByteOffset(data(), ByteCount(), index);
+    }
 
-        static void ParsePrecision(const String& config, FormatSpecifier& spec, SizeType& pos)
+    // Index of the code point that starts at the given byte offset
+    SizeType CodePointIndex(const SizeType offset) const
+    {
+        if (IsAscii())
         {
-            if (pos < config.size() && config[pos] == Def::FullStop)
-            {
-                ++pos;
-                if (pos < config.size() && IsDigit(config[pos].GetCodePoint()))
-                {
-                    spec.precision = std::stoi(config.Substring(pos).str());
-                    while (pos < config.size() && IsDigit(config[pos].GetCodePoint()))
-                    {
-                        ++pos;
-                    }
-                }
-            }
+            return offset;
         }
-
-        static void ParseValueType(const String& config, FormatSpecifier& spec, SizeType& pos)
+        if (length_ <= __Detail::StringIndex::Stride)
         {
-            if (pos < config.size())
-            {
-                if (config[pos] == Def::LatinSmallLetterS)
-                {
-                    spec.type = ValueType::String;
-                    ++pos;
-                }
-                else if (config[pos] == Def::LatinSmallLetterD)
-                {
-                    spec.type = ValueType::Integral;
-                    ++pos;
-                }
-                else if (config[pos] == Def::LatinSmallLetterF)
-                {
-                    spec.type = ValueType::Floating;
-                    ++pos;
-                }
-            }
+            return __Detail::CountUtf8CodePoints(data(), offset);
         }
+        return index_.CodePointIndex(data(), ByteCount(), offset);
+    }
 
-        static FormatSpecifier MakeSpacifier(const String& config)
-        {
-            FormatSpecifier spec;
-            SizeType pos = 0;
+    CharType CharAt(const SizeType offset) const
+    {
+        return CharType{data() + offset, __Detail::Utf8SequenceLength(data()[offset])};
+    }
 
-            if (config[pos++] != Def::Colon)
-            {
-                throw FormatError{"Incorrect format specifier"};
-            }
-            ParseAlignment(config, spec, pos);
-            ParseWidth(config, spec, pos);
-            ParsePrecision(config, spec, pos);
-            ParseValueType(config, spec, pos);
+    void ReplaceChar(const SizeType offset, const CharType& ch)
+    {
+        data_.Replace(offset, __Detail::Utf8SequenceLength(data()[offset]), ch.data(), ch.size());
+        length_ -= ch.IsEmpty() ? 1 : 0;
+        index_.Reset();
+    }
 
-            return spec;
-        }
+    // ASCII runs are copied and converted in place, other code points go through the case table
+    String ConvertCase(void (*convert_ascii)(char*, SizeType), CodePoint (*convert)(CodePoint)) const
+    {
+        String result;
+        result.data_.Reserve(ByteCount());
+        SizeType offset = 0;
 
-    public:
-        static void ProcessAlignment(String& value, const FormatSpecifier& spec)
+        while (offset < ByteCount())
         {
-            if (value.size() >= spec.width)
-            {
-                return;
-            }
-            switch (spec.align)
+            const SizeType ascii = __Detail::AsciiPrefixLength(data() + offset, ByteCount() - offset);
+
+            if (ascii != 0)
             {
-                case Alignment::Left:
-                    value.Append(spec.width - value.size(), spec.fill);
-                    break;
-                case Alignment::Right:
-                    value.Insert(0, spec.width - value.size(), spec.fill);
-                    break;
-                case Alignment::Center:
-                {
-                    const SizeType padding = spec.width - value.size();
-                    value.Insert(0, padding / 2, spec.fill);
-                    value.Append(padding - padding / 2, spec.fill);
-                    break;
-                }
+                const SizeType start = result.data_.Size();
+                result.data_.Append(data() + offset, ascii);
+                convert_ascii(result.data_.Data() + start, ascii);
+                result.length_ += ascii;
+                offset += ascii;
+                continue;
             }
+            char buffer[CharType::MaxSize];
+            const SizeType count = __Detail::EncodeUtf8(convert(__Detail::DecodeUtf8(data() + offset)), buffer);
+            result.data_.Append(buffer, count);
+            ++result.length_;
+            offset = __Detail::Utf8NextOffset(data(), offset);
         }
+        return result;
+    }
 
-        static void ProcessSpecifier(String& value, const FormatSpecifier& spec)
-        {
-            ProcessAlignment(value, spec);
-        }
+private:
+    DataType data_;
+    SizeType length_ = 0;
+    __Detail::StringIndex index_;
+};
 
-        static String ProcessString(const String& value, const FormatSpecifier& spec)
-        {
-            String result = value;
-            ProcessSpecifier(result, spec);
-            return result;
-        }
+// Joins the pieces into a string sized once, e.g. Concat(scheme, "://", host, path)
+template <typename... Args>
+String Concat(const Args&... pieces)
+{
+    const StringView views[] = {StringView(pieces)..., StringView{}};
+    SizeType bytes = 0;
 
-        static String ProcessFloating(const String& value, const FormatSpecifier& spec)
-        {
-            std::ostringstream oss;
-            const auto dot_index = value.Find(Def::FullStop);
+    for (const auto& view : views)
+    {
+        bytes += view.ByteCount();
+    }
+    String result;
+    result.Reserve(bytes);
 
-            if (dot_index != NPosition)
-            {
-                oss << value.Substring(0, dot_index + 1).str();
-
-                if (spec.precision > 0)
-                {
-                    const SizeType limit = dot_index + 1 + spec.precision;
-                    SizeType index = dot_index + 1;
-
-                    while (index < value.size() && IsDigit(value[index].GetCodePoint()) && index < limit)
-                    {
-                        oss << value[index];
-                        ++index;
-                    }
-                    while (index < limit)
-                    {
-                        oss << Def::DigitZero;
-                        ++index;
-                    }
-                }
-            }
-            else
-            {
-                oss << value.str();
-                if (spec.precision > 0)
-                {
-                    oss << Def::FullStop;
-                    for (SizeType i = 0; i < static_cast<SizeType>(spec.precision); ++i)
-                    {
-                        oss << Def::DigitZero;
-                    }
-                }
-            }
-            String result = oss.str();
-            ProcessSpecifier(result, spec);
-            return result;
-        }
+    for (const auto& view : views)
+    {
+        result.Append(view);
+    }
+    return result;
+}
 
-        static String ProcessIntegral(const String& value, const FormatSpecifier& spec)
-        {
-            String result = value;
-            ProcessSpecifier(result, spec);
-            return result;
-        }
+// Concatenation sizes the result once; a temporary operand lends its buffer to the result,
+// so a chain like a + b + c + d grows a single string instead of building one per step
+inline String operator+(const String& left, const String& right)
+{
+    return Concat(left, right);
+}
 
-        static String Process(const String& value, const FormatSpecifier& spec)
-        {
-            const auto type = spec.type;
+inline String operator+(String&& left, const String& right)
+{
+    left.Append(right);
+    return std::move(left);
+}
 
-            switch (type)
-            {
-                case ValueType::Integral:
-                    return ProcessIntegral(value, spec);
-                case ValueType::Floating:
-                    return ProcessFloating(value, spec);
-                default:
-                    return ProcessString(value, spec);
-            }
-        }
-    };
+inline String operator+(const String& left, String&& right)
+{
+    right.Prepend(left);
+    return std::move(right);
+}
 
-private:
-    static CharType DecodeUtf8Char(const char*& cstr)
-    {
-        SizeType len;
-        const Byte c = *cstr;
+inline String operator+(String&& left, String&& right)
+{
+    left.Append(right);
+    return std::move(left);
+}
 
-        if ((c & 0x80) == 0)
-        {
-            len = 1;
-        }
-        else if ((c & 0xE0) == 0xC0)
-        {
-            len = 2;
-        }
-        else if ((c & 0xF0) == 0xE0)
-        {
-            len = 3;
-        }
-        else if ((c & 0xF8) == 0xF0)
-        {
-            len = 4;
-        }
-        else
-        {
-            throw std::runtime_error("Invalid UTF-8 sequence");
-        }
-        return CharType{BasicString(cstr, len)};
-    }
+__CAITLYN_DETAIL_NAMESPACE_BEGIN
 
-private:
-    DataType data_;
-};
+// Other text operands: literals, std::string, views
+template <typename T>
+using ConcatResult = Required<std::is_convertible<const T&, StringView>::value && !std::is_same<T, String>::value,
+                              String>;
+
+__CAITLYN_DETAIL_NAMESPACE_END
+
+template <typename T>
+__Detail::ConcatResult<T> operator+(const String& left, const T& right)
+{
+    return Concat(left, right);
+}
+
+template <typename T>
+__Detail::ConcatResult<T> operator+(String&& left, const T& right)
+{
+    left.Append(StringView(right));
+    return std::move(left);
+}
+
+template <typename T>
+__Detail::ConcatResult<T> operator+(const T& left, const String& right)
+{
+    return Concat(left, right);
+}
+
+template <typename T>
+__Detail::ConcatResult<T> operator+(const T& left, String&& right)
+{
+    right.Prepend(StringView(left));
+    return std::move(right);
+}
+
+inline bool operator==(const char* left, const String& right)
+{
+    return right == left;
+}
+
+inline bool operator!=(const char* left, const String& right)
+{
+    return right != left;
+}
+
+inline bool operator==(const String::BasicString& left, const String& right)
+{
+    return right == left;
+}
+
+inline bool operator!=(const String::BasicString& left, const String& right)
+{
+    return right != left;
+}
+
+// Appends the formatted text to the string
+template <typename... Args>
+void FormatTo(String& output, const __Detail::FormatPattern& format, const Args&... args)
+{
+    output.AppendFormat(format, args...);
+}
+
+__CAITLYN_DETAIL_NAMESPACE_BEGIN
+
+template <typename... Args>
+String FormatChecked(const FormatString& format, const char*, const Args&... args)
+{
+    return String::Format(format, args...);
+}
+
+__CAITLYN_DETAIL_NAMESPACE_END
 
 __CAITLYN_GLOBAL_NAMESPACE_END
 
+// Formats with a literal pattern that is checked at compile time against the argument count and types
+// and parsed once per call site. The check is bound by the constexpr depth limit, 512 by default: literal
+// text costs a level per 256 bytes, a replacement field a few levels plus one per specifier character.
+#define CAITLYN_FORMAT(...)                                                                                          \
+    ::Caitlyn::__Detail::FormatChecked(                                                                              \
+        []() -> const ::Caitlyn::FormatString&                                                                       \
+        {                                                                                                            \
+            static_assert(::Caitlyn::IsValidFormat(__CAITLYN_FORMAT_PATTERN(__VA_ARGS__, ~),                         \
+                                                   decltype(::Caitlyn::__Detail::CountFormatArguments(               \
+                                                       __VA_ARGS__))::value,                                         \
+                                                   decltype(::Caitlyn::__Detail::PlainFormatArguments(               \
+                                                       __VA_ARGS__))::value),                                        \
+                          "Invalid format string");                                                                  \
+            static const ::Caitlyn::FormatString format{__CAITLYN_FORMAT_PATTERN(__VA_ARGS__, ~)};                  \
+            return format;                                                                                           \
+        }(),                                                                                                         \
+        __VA_ARGS__)
+
+#define __CAITLYN_FORMAT_PATTERN(format, ...) format
+
+namespace std
+{
+template <>
+struct hash<Caitlyn::String>
+{
+    size_t operator()(const Caitlyn::String& str) const noexcept
+    {
+        return Caitlyn::Hash(str);
+    }
+};
+} // namespace std
+
 inline std::istream& operator>>(std::istream& is, Caitlyn::String& str)
 {
     if (is.good())
@@ -1021,7 +1011,12 @@ inline std::istream& operator>>(std::istream& is, Caitlyn::String& str)
 
 inline std::ostream& operator<<(std::ostream& os, const Caitlyn::String& str)
 {
-    os << str.str();
+    // Padding set with std::setw is applied by the formatted insertion of a copy
+    if (os.width() != 0)
+    {
+        return os << str.str();
+    }
+    os.write(str.data(), static_cast<std::streamsize>(str.ByteCount()));
     return os;
 }
 
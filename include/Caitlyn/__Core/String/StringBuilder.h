@@ -18,74 +18,146 @@
 #ifndef CAITLYN_CORE_STRING_STRINGBUILDER_H_
 #define CAITLYN_CORE_STRING_STRINGBUILDER_H_
 
+#include <utility>
+#include <vector>
+
+#include "Caitlyn/__Core/String/Format.h"
+#include "Caitlyn/__Core/String/Storage.h"
 #include "Caitlyn/__Core/String/String.h"
+#include "Caitlyn/__Core/String/StringView.h"
 
 __CAITLYN_GLOBAL_NAMESPACE_BEGIN
 
+// Assembles text in one growable byte buffer; formatted pieces are written straight into it
 class StringBuilder
 {
 public:
-    using data_type = std::ostringstream;
+    using data_type = String;
 
 public:
     StringBuilder() = default;
 
     StringBuilder(const char str)
     {
-        data_ << str;
+        data_.Append(StringView{&str, 1});
     }
 
     StringBuilder(const char* str)
     {
-        data_ << str;
+        data_.Append(str);
     }
 
-    StringBuilder(const String& str)
+    StringBuilder(const StringView& str)
     {
-        data_ << str;
+        data_.Append(str);
     }
 
-    template <typename... Args>
-    StringBuilder(const String& str, Args&&... args)
+    StringBuilder(const String& str) : data_{str}
     {
-        data_ << String::Format(str, std::forward<Args>(args)...);
     }
 
-    StringBuilder(const StringBuilder& other) : data_{other.data_.str()}
+    StringBuilder(String&& str) noexcept : data_{std::move(str)}
     {
     }
 
-    StringBuilder(StringBuilder&& other) noexcept : data_{std::move(other.data_)}
+    template <typename Arg, typename... Args>
+    StringBuilder(const __Detail::FormatPattern& format, const Arg& arg, const Args&... args)
     {
+        data_.AppendFormat(format, arg, args...);
     }
 
 public:
-    void Append(const String& str)
+    void Append(const StringView& str)
     {
-        data_ << str;
+        data_.Append(str);
+    }
+
+    template <typename Arg, typename... Args>
+    void Append(const __Detail::FormatPattern& format, const Arg& arg, const Args&... args)
+    {
+        data_.AppendFormat(format, arg, args...);
     }
 
     template <typename... Args>
-    void Append(const String& str, Args&&... args)
+    void AppendFormat(const __Detail::FormatPattern& format, const Args&... args)
     {
-        data_ << String::Format(str, std::forward<Args>(args)...);
+        data_.AppendFormat(format, args...);
     }
 
-    void AppendLine(const String& str)
+    void AppendLine()
     {
-        data_ << str << Def::LineFeed;
+        data_.Append(StringView{Def::LineFeed});
     }
 
-    template <typename... Args>
-    void AppendLine(const String& str, Args&&... args)
+    void AppendLine(const StringView& str)
+    {
+        data_.Append(str);
+        AppendLine();
+    }
+
+    template <typename Arg, typename... Args>
+    void AppendLine(const __Detail::FormatPattern& format, const Arg& arg, const Args&... args)
+    {
+        data_.AppendFormat(format, arg, args...);
+        AppendLine();
+    }
+
+public:
+    // Capacity in bytes
+    void Reserve(const SizeType bytes)
+    {
+        data_.Reserve(bytes);
+    }
+
+    SizeType Capacity() const
+    {
+        return data_.Capacity();
+    }
+
+    SizeType Length() const
+    {
+        return data_.Length();
+    }
+
+    SizeType ByteCount() const
+    {
+        return data_.ByteCount();
+    }
+
+    bool IsEmpty() const
     {
-        data_ << String::Format(str, std::forward<Args>(args)...) << Def::LineFeed;
+        return data_.IsEmpty();
+    }
+
+    // Removes the text and keeps the buffer for reuse
+    void Clear()
+    {
+        data_.Clear();
     }
 
 public:
+    // The view is valid until the builder is changed
+    StringView View() const
+    {
+        return data_.View();
+    }
+
     String str() const
     {
-        return data_.str();
+        return data_;
+    }
+
+    // Moves the buffer into the result without copying, the builder is empty afterwards
+    String Release()
+    {
+        String result{std::move(data_)};
+        data_.Clear();
+        return result;
+    }
+
+    void WriteFormat(FormatBuffer& buffer, const __Detail::FormatSpecifier* spec) const
+    {
+        __Detail::FormatWriter::Write(buffer, View(), spec);
     }
 
 private:
@@ -102,17 +174,179 @@ inline StringBuilder MakeText(const char c)
     return StringBuilder{c};
 }
 
-inline StringBuilder MakeText(const String& str)
+inline StringBuilder MakeText(const StringView& str)
 {
     return StringBuilder{str};
 }
 
-template <typename... Args>
-StringBuilder MakeText(const String& str, Args&&... args)
+template <typename Arg, typename... Args>
+StringBuilder MakeText(const __Detail::FormatPattern& format, const Arg& arg, const Args&... args)
 {
-    return StringBuilder{String::Format(str, std::forward<Args>(args)...)};
+    return StringBuilder{format, arg, args...};
+}
+
+struct StringBuilderPoolStats
+{
+    // Builders created on the thread and how many of them got a pooled buffer
+    SizeType borrowed = 0;
+    SizeType reused = 0;
+    // Buffers freed on return because they grew past the retain limit
+    SizeType trimmed = 0;
+    // Bytes held by the idle buffers and the largest buffer returned so far
+    SizeType retained_bytes = 0;
+    SizeType high_water = 0;
+};
+
+// Idle builder buffers of the calling thread. A returned buffer keeps its capacity for the next
+// builder unless it grew past the retain limit, so one large report does not pin its memory.
+class StringBuilderPool
+{
+public:
+    static StringBuilderPoolStats Stats()
+    {
+        return Local().stats_;
+    }
+
+    // Largest capacity in bytes a returned buffer may keep
+    static void SetRetainLimit(const SizeType bytes)
+    {
+        Local().retain_limit_ = bytes;
+        Trim(bytes);
+    }
+
+    static SizeType RetainLimit()
+    {
+        return Local().retain_limit_;
+    }
+
+    // Frees the idle buffers larger than the given capacity, all of them by default
+    static void Trim(const SizeType capacity = 0)
+    {
+        StringBuilderPool& pool = Local();
+        auto& buffers = pool.buffers_;
+
+        for (SizeType i = buffers.size(); i-- > 0;)
+        {
+            if (buffers[i].Capacity() > capacity)
+            {
+                pool.stats_.retained_bytes -= buffers[i].Capacity();
+                buffers.erase(buffers.begin() + static_cast<PtrDiff>(i));
+            }
+        }
+    }
+
+    static String Acquire()
+    {
+        StringBuilderPool& pool = Local();
+        ++pool.stats_.borrowed;
+
+        if (pool.buffers_.empty())
+        {
+            return String{};
+        }
+        String buffer = std::move(pool.buffers_.back());
+        pool.buffers_.pop_back();
+        pool.stats_.retained_bytes -= buffer.Capacity();
+        ++pool.stats_.reused;
+        return buffer;
+    }
+
+    static void Recycle(String&& buffer)
+    {
+        StringBuilderPool& pool = Local();
+        const SizeType capacity = buffer.Capacity();
+        pool.stats_.high_water = std::max(pool.stats_.high_water, capacity);
+
+        // Inline buffers cost nothing to create again
+        if (capacity <= __Detail::StringStorage::InlineCapacity)
+        {
+            return;
+        }
+        if (capacity > pool.retain_limit_)
+        {
+            ++pool.stats_.trimmed;
+            return;
+        }
+        // Nested builders are rare, a few idle buffers cover them
+        if (pool.buffers_.size() < MaxBuffers)
+        {
+            buffer.Clear();
+            pool.stats_.retained_bytes += capacity;
+            pool.buffers_.push_back(std::move(buffer));
+        }
+    }
+
+private:
+    static StringBuilderPool& Local()
+    {
+        thread_local StringBuilderPool pool;
+        return pool;
+    }
+
+private:
+    static constexpr SizeType MaxBuffers = 4;
+
+    std::vector<String> buffers_;
+    SizeType retain_limit_ = 64 * 1024;
+    StringBuilderPoolStats stats_;
+};
+
+// Builder that borrows an idle buffer of the thread and gives it back when destroyed;
+// Release hands the buffer over to the result instead
+class PooledStringBuilder : public StringBuilder
+{
+public:
+    PooledStringBuilder() : StringBuilder(StringBuilderPool::Acquire())
+    {
+    }
+
+    PooledStringBuilder(const PooledStringBuilder&) = delete;
+
+    PooledStringBuilder(PooledStringBuilder&& other) noexcept : StringBuilder(std::move(other)), owner_{other.owner_}
+    {
+        other.owner_ = false;
+    }
+
+    PooledStringBuilder& operator=(const PooledStringBuilder&) = delete;
+    PooledStringBuilder& operator=(PooledStringBuilder&&) = delete;
+
+    ~PooledStringBuilder()
+    {
+        if (owner_)
+        {
+            StringBuilderPool::Recycle(Release());
+        }
+    }
+
+private:
+    bool owner_ = true;
+};
+
+inline PooledStringBuilder MakePooledText()
+{
+    return PooledStringBuilder{};
+}
+
+inline PooledStringBuilder MakePooledText(const StringView& str)
+{
+    PooledStringBuilder builder;
+    builder.Append(str);
+    return builder;
+}
+
+template <typename Arg, typename... Args>
+PooledStringBuilder MakePooledText(const __Detail::FormatPattern& format, const Arg& arg, const Args&... args)
+{
+    PooledStringBuilder builder;
+    builder.AppendFormat(format, arg, args...);
+    return builder;
 }
 
 __CAITLYN_GLOBAL_NAMESPACE_END
 
+inline std::ostream& operator<<(std::ostream& os, const Caitlyn::StringBuilder& builder)
+{
+    return os << builder.View();
+}
+
 #endif // CAITLYN_CORE_STRING_STRINGBUILDER_H_
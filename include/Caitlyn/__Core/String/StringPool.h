@@ -0,0 +1,305 @@
+/**
+ * This file is part of the Caitlyn library
+ * Copyright (C) 2024 Alexander Szawrowski
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CAITLYN_CORE_STRING_STRING_POOL_H_
+#define CAITLYN_CORE_STRING_STRING_POOL_H_
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+#include "Caitlyn/__Base.h"
+#include "Caitlyn/__Core/String/Hash.h"
+#include "Caitlyn/__Core/String/String.h"
+#include "Caitlyn/__Core/String/StringView.h"
+
+__CAITLYN_GLOBAL_NAMESPACE_BEGIN
+__CAITLYN_DETAIL_NAMESPACE_BEGIN
+
+// Interned string, the NUL-terminated bytes follow it in the pool arena
+struct AtomData
+{
+    SizeType bytes;
+    SizeType length;
+    SizeType hash;
+
+    const char* Bytes() const
+    {
+        return reinterpret_cast<const char*>(this + 1);
+    }
+};
+
+// Pool lookup key carrying the hash of the bytes, so that it is computed once per lookup
+struct AtomKey
+{
+    StringView view;
+    SizeType hash;
+
+    bool operator==(const AtomKey& other) const
+    {
+        return hash == other.hash && view == other.view;
+    }
+};
+
+struct AtomKeyHash
+{
+    SizeType operator()(const AtomKey& key) const
+    {
+        return key.hash;
+    }
+};
+
+__CAITLYN_DETAIL_NAMESPACE_END
+
+// Handle of a string interned in a StringPool. Equal strings of one pool share a handle,
+// so comparison is a pointer comparison. Valid while the pool exists.
+class Atom
+{
+public:
+    Atom() = default;
+
+public:
+    SizeType size() const
+    {
+        return data_ ? data_->length : 0;
+    }
+
+    SizeType Length() const
+    {
+        return size();
+    }
+
+    SizeType ByteCount() const
+    {
+        return data_ ? data_->bytes : 0;
+    }
+
+    bool IsEmpty() const
+    {
+        return data_ == nullptr;
+    }
+
+    bool NotEmpty() const
+    {
+        return data_ != nullptr;
+    }
+
+    // Pointer to the NUL-terminated UTF-8 bytes
+    const char* data() const
+    {
+        return data_ ? data_->Bytes() : "";
+    }
+
+    SizeType Hash() const
+    {
+        return data_ ? data_->hash : __Detail::HashBytes("", 0);
+    }
+
+    StringView View() const
+    {
+        return __Detail::MakeTrustedView(data(), ByteCount(), size());
+    }
+
+    operator StringView() const
+    {
+        return View();
+    }
+
+    String ToString() const
+    {
+        return String{View()};
+    }
+
+public:
+    bool operator==(const Atom& other) const
+    {
+        return data_ == other.data_;
+    }
+
+    bool operator!=(const Atom& other) const
+    {
+        return data_ != other.data_;
+    }
+
+private:
+    friend class StringPool;
+
+    explicit Atom(const __Detail::AtomData* data) : data_{data}
+    {
+    }
+
+private:
+    const __Detail::AtomData* data_ = nullptr;
+};
+
+// Thread-safe set of interned strings. The strings are kept in arena blocks until the pool
+// is destroyed; lookups are spread over independently locked shards.
+class StringPool
+{
+public:
+    static constexpr SizeType ShardCount = 16;
+    static constexpr SizeType BlockSize = 16 * 1024;
+
+public:
+    StringPool() = default;
+
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+public:
+    // Process-wide pool
+    static StringPool& Global()
+    {
+        static StringPool pool;
+        return pool;
+    }
+
+    Atom Intern(const StringView& str)
+    {
+        if (str.IsEmpty())
+        {
+            return Atom{};
+        }
+        const __Detail::AtomKey key{str, __Detail::HashBytes(str.data(), str.ByteCount())};
+        Shard& shard = shards_[ShardIndex(key.hash)];
+        std::lock_guard<std::mutex> lock{shard.mutex};
+        const auto it = shard.atoms.find(key);
+
+        if (it != shard.atoms.end())
+        {
+            return Atom{it->second};
+        }
+        const __Detail::AtomData* data = shard.Allocate(str, key.hash);
+        const auto view = __Detail::MakeTrustedView(data->Bytes(), data->bytes, data->length);
+        shard.atoms.emplace(__Detail::AtomKey{view, key.hash}, data);
+        return Atom{data};
+    }
+
+    // Existing handle of the string, an empty atom if it was not interned
+    Atom Find(const StringView& str) const
+    {
+        if (str.IsEmpty())
+        {
+            return Atom{};
+        }
+        const __Detail::AtomKey key{str, __Detail::HashBytes(str.data(), str.ByteCount())};
+        const Shard& shard = shards_[ShardIndex(key.hash)];
+        std::lock_guard<std::mutex> lock{shard.mutex};
+        const auto it = shard.atoms.find(key);
+        return it != shard.atoms.end() ? Atom{it->second} : Atom{};
+    }
+
+    // Number of distinct strings
+    SizeType Size() const
+    {
+        SizeType size = 0;
+
+        for (const auto& shard : shards_)
+        {
+            std::lock_guard<std::mutex> lock{shard.mutex};
+            size += shard.atoms.size();
+        }
+        return size;
+    }
+
+private:
+    // The shard is picked by the high bits, the low ones select the bucket inside the shard map
+    static SizeType ShardIndex(const SizeType hash)
+    {
+        return (hash >> (std::numeric_limits<SizeType>::digits - 8)) % ShardCount;
+    }
+
+    struct Shard
+    {
+        mutable std::mutex mutex;
+        std::unordered_map<__Detail::AtomKey, const __Detail::AtomData*, __Detail::AtomKeyHash> atoms;
+        std::vector<std::unique_ptr<char[]>> blocks;
+        SizeType used = BlockSize;
+
+        const __Detail::AtomData* Allocate(const StringView& str, const SizeType hash)
+        {
+            constexpr SizeType alignment = alignof(__Detail::AtomData);
+            const SizeType size = (sizeof(__Detail::AtomData) + str.ByteCount() + alignment) / alignment * alignment;
+
+            char* memory;
+
+            if (size > BlockSize / 4)
+            {
+                // Large strings get a block of their own, the current block stays last
+                blocks.emplace_back(new char[size]);
+                memory = blocks.back().get();
+
+                if (blocks.size() > 1)
+                {
+                    std::swap(blocks.back(), blocks[blocks.size() - 2]);
+                }
+            }
+            else
+            {
+                if (used + size > BlockSize)
+                {
+                    blocks.emplace_back(new char[BlockSize]);
+                    used = 0;
+                }
+                memory = blocks.back().get() + used;
+                used += size;
+            }
+
+            auto* data = new (memory) __Detail::AtomData{str.ByteCount(), str.Length(), hash};
+            std::memcpy(memory + sizeof(__Detail::AtomData), str.data(), str.ByteCount());
+            memory[sizeof(__Detail::AtomData) + str.ByteCount()] = '\0';
+            return data;
+        }
+    };
+
+private:
+    Shard shards_[ShardCount];
+};
+
+// Interns the string in the process-wide pool
+inline Atom Intern(const StringView& str)
+{
+    return StringPool::Global().Intern(str);
+}
+
+__CAITLYN_GLOBAL_NAMESPACE_END
+
+namespace std
+{
+template <>
+struct hash<Caitlyn::Atom>
+{
+    size_t operator()(const Caitlyn::Atom& atom) const noexcept
+    {
+        return atom.Hash();
+    }
+};
+} // namespace std
+
+inline std::ostream& operator<<(std::ostream& os, const Caitlyn::Atom& atom)
+{
+    return os << atom.View();
+}
+
+#endif // CAITLYN_CORE_STRING_STRING_POOL_H_
@@ -0,0 +1,297 @@
+/**
+ * This file is part of the Caitlyn library
+ * Copyright (C) 2024 Alexander Szawrowski
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CAITLYN_CORE_STRING_STRINGVIEW_H_
+#define CAITLYN_CORE_STRING_STRINGVIEW_H_
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "Caitlyn/__Base.h"
+#include "Caitlyn/__Core/Char.h"
+#include "Caitlyn/__Core/String/Algorithms/Search.h"
+#include "Caitlyn/__Core/String/Iterator.h"
+#include "Caitlyn/__Core/String/Utf8.h"
+
+__CAITLYN_GLOBAL_NAMESPACE_BEGIN
+
+class StringView;
+
+__CAITLYN_DETAIL_NAMESPACE_BEGIN
+
+StringView MakeTrustedView(const char* bytes, SizeType count, SizeType length);
+
+__CAITLYN_DETAIL_NAMESPACE_END
+
+// Non-owning read-only view of UTF-8 bytes owned by a String or another buffer
+class StringView
+{
+public:
+    using ValueType = char;
+    using CharType = Char;
+    using BasicString = std::basic_string<ValueType>;
+    using ConstIterator = __Detail::StringConstIterator<StringView, false>;
+    using ConstReverseIterator = __Detail::StringConstIterator<StringView, true>;
+
+public:
+    StringView() = default;
+
+    StringView(const char* str) : StringView(str, std::strlen(str))
+    {
+    }
+
+    StringView(const char* bytes, const SizeType count)
+        : data_{bytes}, size_{count}, length_{__Detail::ValidateUtf8(bytes, count)}
+    {
+    }
+
+    StringView(const BasicString& str) : StringView(str.data(), str.size())
+    {
+    }
+
+public:
+    SizeType size() const
+    {
+        return length_;
+    }
+
+    SizeType Length() const
+    {
+        return length_;
+    }
+
+    SizeType ByteCount() const
+    {
+        return size_;
+    }
+
+    bool IsEmpty() const
+    {
+        return size_ == 0;
+    }
+
+    bool NotEmpty() const
+    {
+        return size_ != 0;
+    }
+
+    bool IsAscii() const
+    {
+        return length_ == size_;
+    }
+
+    const ValueType* data() const
+    {
+        return data_;
+    }
+
+    BasicString str() const
+    {
+        return BasicString(data_, size_);
+    }
+
+    CharType operator[](const SizeType index) const
+    {
+        return CharAt(ByteOffset(index));
+    }
+
+    CharType At(const SizeType index) const
+    {
+        if (index >= size())
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        return CharAt(ByteOffset(index));
+    }
+
+public:
+    ConstIterator begin() const
+    {
+        return ConstIterator{this, 0};
+    }
+
+    ConstIterator end() const
+    {
+        return ConstIterator{this, size_};
+    }
+
+    ConstReverseIterator rbegin() const
+    {
+        return ++ConstReverseIterator{this, size_};
+    }
+
+    ConstReverseIterator rend() const
+    {
+        return ConstReverseIterator{this, NPosition};
+    }
+
+public:
+    bool StartsWith(const StringView& prefix) const
+    {
+        return prefix.size_ <= size_ && std::memcmp(data_, prefix.data_, prefix.size_) == 0;
+    }
+
+    bool EndsWith(const StringView& suffix) const
+    {
+        return suffix.size_ <= size_ && std::memcmp(data_ + size_ - suffix.size_, suffix.data_, suffix.size_) == 0;
+    }
+
+    bool Contains(const StringView& substring) const
+    {
+        return __Detail::FindBytes(data_, size_, substring.data_, substring.size_) != __Detail::NotFound;
+    }
+
+    SizeType Find(const StringView& substr, const SizeType pos = 0) const
+    {
+        if (pos > size())
+        {
+            return NPosition;
+        }
+        const auto offset = __Detail::FindBytes(data_, size_, substr.data_, substr.size_, ByteOffset(pos));
+        return offset != __Detail::NotFound ? CodePointIndex(offset) : NPosition;
+    }
+
+    SizeType ReverseFind(const StringView& substr, const SizeType pos = NPosition) const
+    {
+        if (substr.size() > size())
+        {
+            return NPosition;
+        }
+        const auto from = pos >= size() ? __Detail::NotFound : ByteOffset(pos);
+        const auto offset = __Detail::ReverseFindBytes(data_, size_, substr.data_, substr.size_, from);
+        return offset != __Detail::NotFound ? CodePointIndex(offset) : NPosition;
+    }
+
+    StringView Substring(const SizeType pos, const SizeType count = NPosition) const
+    {
+        if (pos > size())
+        {
+            throw std::out_of_range("Position out of range");
+        }
+        const SizeType length = std::min(count, size() - pos);
+        const SizeType first = ByteOffset(pos);
+        return StringView{data_ + first, ByteOffset(pos + length) - first, length};
+    }
+
+public:
+    // Lexicographic comparison of the bytes, which matches code point order
+    int Compare(const StringView& other) const
+    {
+        const int result = std::memcmp(data_, other.data_, std::min(size_, other.size_));
+
+        if (result != 0)
+        {
+            return result;
+        }
+        return size_ < other.size_ ? -1 : (size_ > other.size_ ? 1 : 0);
+    }
+
+    bool operator==(const StringView& other) const
+    {
+        return size_ == other.size_ && std::memcmp(data_, other.data_, size_) == 0;
+    }
+
+    bool operator!=(const StringView& other) const
+    {
+        return !(*this == other);
+    }
+
+    bool operator<(const StringView& other) const
+    {
+        return Compare(other) < 0;
+    }
+
+    bool operator>(const StringView& other) const
+    {
+        return Compare(other) > 0;
+    }
+
+    bool operator<=(const StringView& other) const
+    {
+        return Compare(other) <= 0;
+    }
+
+    bool operator>=(const StringView& other) const
+    {
+        return Compare(other) >= 0;
+    }
+
+public:
+    static constexpr auto NPosition{static_cast<SizeType>(-1)};
+
+private:
+    friend StringView __Detail::MakeTrustedView(const char* bytes, SizeType count, SizeType length);
+
+    template <typename, bool>
+    friend class __Detail::StringConstIterator;
+
+    // Borrows bytes that are already known to be valid UTF-8
+    StringView(const char* bytes, const SizeType count, const SizeType length)
+        : data_{bytes}, size_{count}, length_{length}
+    {
+    }
+
+    SizeType ByteOffset(const SizeType index) const
+    {
+        if (index >= length_)
+        {
+            return size_;
+        }
+        if (IsAscii())
+        {
+            return index;
+        }
+        return __Detail::Utf8ByteOffset(data_, size_, index);
+    }
+
+    SizeType CodePointIndex(const SizeType offset) const
+    {
+        return IsAscii() ? offset : __Detail::CountUtf8CodePoints(data_, offset);
+    }
+
+    CharType CharAt(const SizeType offset) const
+    {
+        return CharType{data_ + offset, __Detail::Utf8SequenceLength(data_[offset])};
+    }
+
+private:
+    const ValueType* data_ = "";
+    SizeType size_ = 0;
+    SizeType length_ = 0;
+};
+
+__CAITLYN_DETAIL_NAMESPACE_BEGIN
+
+// Borrows bytes that the caller has already validated as UTF-8 holding length code points
+inline StringView MakeTrustedView(const char* bytes, const SizeType count, const SizeType length)
+{
+    return StringView{bytes, count, length};
+}
+
+__CAITLYN_DETAIL_NAMESPACE_END
+
+__CAITLYN_GLOBAL_NAMESPACE_END
+
+inline std::ostream& operator<<(std::ostream& os, const Caitlyn::StringView& str)
+{
+    os.write(str.data(), static_cast<std::streamsize>(str.ByteCount()));
+    return os;
+}
+
+#endif // CAITLYN_CORE_STRING_STRINGVIEW_H_
@@ -0,0 +1,393 @@
+/**
+ * This file is part of the Caitlyn library
+ * Copyright (C) 2024 Alexander Szawrowski
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CAITLYN_CORE_STRING_UTF8_H_
+#define CAITLYN_CORE_STRING_UTF8_H_
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "Caitlyn/__Base.h"
+#include "Caitlyn/__Core/String/Simd.h"
+
+__CAITLYN_GLOBAL_NAMESPACE_BEGIN
+__CAITLYN_DETAIL_NAMESPACE_BEGIN
+
+inline bool IsUtf8Continuation(const char byte)
+{
+    return (static_cast<Byte>(byte) & 0xC0) == 0x80;
+}
+
+// Length of the sequence started by the lead byte, 0 for an invalid lead
+inline SizeType Utf8SequenceLength(const char lead)
+{
+    const auto byte = static_cast<Byte>(lead);
+
+    if ((byte & 0x80) == 0)
+    {
+        return 1;
+    }
+    if ((byte & 0xE0) == 0xC0)
+    {
+        return 2;
+    }
+    if ((byte & 0xF0) == 0xE0)
+    {
+        return 3;
+    }
+    if ((byte & 0xF8) == 0xF0)
+    {
+        return 4;
+    }
+    return 0;
+}
+
+// Length of the well-formed sequence at the beginning of the bytes, 0 if it is malformed.
+// Rejects overlong forms, surrogates and code points above U+10FFFF.
+inline SizeType Utf8ValidSequenceLength(const char* data, const SizeType size)
+{
+    const auto lead = static_cast<Byte>(data[0]);
+
+    if (lead < 0x80)
+    {
+        return 1;
+    }
+    const SizeType length = Utf8SequenceLength(data[0]);
+
+    if (length < 2 || length > size || lead == 0xC0 || lead == 0xC1 || lead > 0xF4)
+    {
+        return 0;
+    }
+    for (SizeType i = 1; i < length; ++i)
+    {
+        if (!IsUtf8Continuation(data[i]))
+        {
+            return 0;
+        }
+    }
+    const auto second = static_cast<Byte>(data[1]);
+
+    if ((lead == 0xE0 && second < 0xA0) || (lead == 0xED && second > 0x9F) || (lead == 0xF0 && second < 0x90) ||
+        (lead == 0xF4 && second > 0x8F))
+    {
+        return 0;
+    }
+    return length;
+}
+
+// Validates the bytes from the offset up to the stop position and counts the code points.
+// A sequence started before the stop may end after it.
+inline bool ValidateUtf8Scalar(const char* data, const SizeType size, SizeType& offset, const SizeType stop,
+                               SizeType& count)
+{
+    while (offset < stop)
+    {
+        const SizeType length = Utf8ValidSequenceLength(data + offset, size - offset);
+
+        if (length == 0)
+        {
+            return false;
+        }
+        offset += length;
+        ++count;
+    }
+    return true;
+}
+
+#if __CAITLYN_HAS_AVX2
+// Block validator from "Validating UTF-8 In Less Than One Instruction Per Byte" (Keiser, Lemire):
+// every byte pair is classified by three nibble lookup tables, the results must not intersect.
+struct Utf8Avx2Validator
+{
+    static constexpr char TooShort = 1 << 0;
+    static constexpr char TooLong = 1 << 1;
+    static constexpr char Overlong3 = 1 << 2;
+    static constexpr char TooLarge = 1 << 3;
+    static constexpr char Surrogate = 1 << 4;
+    static constexpr char Overlong2 = 1 << 5;
+    static constexpr char TooLarge1000 = 1 << 6;
+    static constexpr char Overlong4 = 1 << 6;
+    static constexpr char TwoConts = static_cast<char>(1 << 7);
+    static constexpr char Carry = TooShort | TooLong | TwoConts;
+
+    // Input shifted right by N bytes with the tail of the previous block shifted in
+    template <int N>
+    static __m256i Previous(const __m256i input, const __m256i previous)
+    {
+        return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(previous, input, 0x21), 16 - N);
+    }
+
+    static __m256i HighNibbles(const __m256i input)
+    {
+        return _mm256_and_si256(_mm256_srli_epi16(input, 4), _mm256_set1_epi8(0x0F));
+    }
+
+    static __m256i CheckSpecialCases(const __m256i input, const __m256i previous1)
+    {
+        const __m256i byte1_high = _mm256_shuffle_epi8(
+            _mm256_setr_epi8(TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TwoConts,
+                             TwoConts, TwoConts, TwoConts, TooShort | Overlong2, TooShort,
+                             TooShort | Overlong3 | Surrogate, TooShort | TooLarge | TooLarge1000 | Overlong4,
+                             TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TwoConts,
+                             TwoConts, TwoConts, TwoConts, TooShort | Overlong2, TooShort,
+                             TooShort | Overlong3 | Surrogate, TooShort | TooLarge | TooLarge1000 | Overlong4),
+            HighNibbles(previous1));
+
+        const char large = Carry | TooLarge | TooLarge1000;
+        const char first = Carry | Overlong3 | Overlong2 | Overlong4;
+        const __m256i byte1_low = _mm256_shuffle_epi8(
+            _mm256_setr_epi8(first, Carry | Overlong2, Carry, Carry, Carry | TooLarge, large, large, large, large,
+                             large, large, large, large, large | Surrogate, large, large, first, Carry | Overlong2,
+                             Carry, Carry, Carry | TooLarge, large, large, large, large, large, large, large, large,
+                             large | Surrogate, large, large),
+            _mm256_and_si256(previous1, _mm256_set1_epi8(0x0F)));
+
+        const char cont80 = TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge1000 | Overlong4;
+        const char cont90 = TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge;
+        const char contA0 = TooLong | Overlong2 | TwoConts | Surrogate | TooLarge;
+        const __m256i byte2_high = _mm256_shuffle_epi8(
+            _mm256_setr_epi8(TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, cont80,
+                             cont90, contA0, contA0, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort,
+                             TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, cont80, cont90, contA0,
+                             contA0, TooShort, TooShort, TooShort, TooShort),
+            HighNibbles(input));
+
+        return _mm256_and_si256(_mm256_and_si256(byte1_high, byte1_low), byte2_high);
+    }
+
+    // Third and fourth bytes of a sequence must be continuations, the tables only see byte pairs
+    static __m256i CheckMultibyteLengths(const __m256i input, const __m256i previous, const __m256i special_cases)
+    {
+        const __m256i third = _mm256_subs_epu8(Previous<2>(input, previous), _mm256_set1_epi8(0xE0 - 0x80));
+        const __m256i fourth = _mm256_subs_epu8(Previous<3>(input, previous), _mm256_set1_epi8(0xF0 - 0x80));
+        const __m256i must_continue =
+            _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8(static_cast<char>(0x80)));
+        return _mm256_xor_si256(must_continue, special_cases);
+    }
+
+    // Non-zero if the block ends in the middle of a sequence
+    static __m256i CheckIncomplete(const __m256i input)
+    {
+        const __m256i max_value = _mm256_setr_epi8(
+            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+            -1, -1, -1, static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+        return _mm256_subs_epu8(input, max_value);
+    }
+
+    static bool Validate(const char* data, const SizeType size, SizeType& count)
+    {
+        __m256i error = _mm256_setzero_si256();
+        __m256i previous = _mm256_setzero_si256();
+        __m256i incomplete = _mm256_setzero_si256();
+        const __m256i continuation_max = _mm256_set1_epi8(static_cast<char>(0xBF));
+
+        for (SizeType offset = 0; offset < size; offset += 32)
+        {
+            const SizeType block_size = std::min<SizeType>(32, size - offset);
+            __m256i input;
+
+            if (block_size == 32)
+            {
+                input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + offset));
+            }
+            else
+            {
+                // Zero padding keeps a truncated sequence at the end detectable
+                alignas(32) char tail[32] = {};
+                std::memcpy(tail, data + offset, block_size);
+                input = _mm256_load_si256(reinterpret_cast<const __m256i*>(tail));
+            }
+            if (_mm256_movemask_epi8(input) == 0)
+            {
+                error = _mm256_or_si256(error, incomplete);
+                count += block_size;
+            }
+            else
+            {
+                const __m256i special_cases = CheckSpecialCases(input, Previous<1>(input, previous));
+                error = _mm256_or_si256(error, CheckMultibyteLengths(input, previous, special_cases));
+                incomplete = CheckIncomplete(input);
+
+                // Continuation bytes are the only ones not greater than 0xBF as signed values,
+                // the zero padding is counted as ASCII and has to be subtracted
+                const __m256i leading = _mm256_cmpgt_epi8(input, continuation_max);
+                count += PopCount(static_cast<UInt32>(_mm256_movemask_epi8(leading))) - (32 - block_size);
+            }
+            previous = input;
+        }
+        error = _mm256_or_si256(error, incomplete);
+        return _mm256_testz_si256(error, error) != 0;
+    }
+};
+#endif
+
+// Checks the byte sequence and returns the number of code points in it
+inline SizeType ValidateUtf8(const char* data, const SizeType size)
+{
+    SizeType count = 0;
+    bool valid = true;
+
+#if __CAITLYN_HAS_AVX2
+    valid = Utf8Avx2Validator::Validate(data, size, count);
+#elif __CAITLYN_HAS_SSE2
+    SizeType offset = 0;
+
+    while (valid && offset < size)
+    {
+        // Skip whole ASCII blocks, then check the rest of the block containing non-ASCII bytes
+        while (offset + 16 <= size &&
+               _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset))) == 0)
+        {
+            offset += 16;
+            count += 16;
+        }
+        valid = ValidateUtf8Scalar(data, size, offset, std::min<SizeType>(size, offset + 16), count);
+    }
+#else
+    SizeType offset = 0;
+
+    while (valid && offset < size)
+    {
+        // Eight ASCII bytes at a time
+        UInt64 word;
+
+        while (offset + sizeof(word) <= size)
+        {
+            std::memcpy(&word, data + offset, sizeof(word));
+
+            if ((word & 0x8080808080808080ULL) != 0)
+            {
+                break;
+            }
+            offset += sizeof(word);
+            count += sizeof(word);
+        }
+        valid = ValidateUtf8Scalar(data, size, offset, std::min<SizeType>(size, offset + sizeof(word)), count);
+    }
+#endif
+    if (!valid)
+    {
+        throw std::runtime_error("Invalid UTF-8 sequence");
+    }
+    return count;
+}
+
+inline SizeType CountUtf8CodePoints(const char* data, const SizeType size)
+{
+    SizeType count = 0;
+    SizeType i = 0;
+
+#if __CAITLYN_HAS_SSE2
+    const __m128i continuation_max = _mm_set1_epi8(static_cast<char>(0xBF));
+
+    for (; i + 16 <= size; i += 16)
+    {
+        const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        count += PopCount(static_cast<UInt32>(_mm_movemask_epi8(_mm_cmpgt_epi8(input, continuation_max))));
+    }
+#endif
+    for (; i < size; ++i)
+    {
+        if (!IsUtf8Continuation(data[i]))
+        {
+            ++count;
+        }
+    }
+    return count;
+}
+
+inline SizeType Utf8NextOffset(const char* data, const SizeType offset)
+{
+    return offset + Utf8SequenceLength(data[offset]);
+}
+
+inline SizeType Utf8PrevOffset(const char* data, SizeType offset)
+{
+    do
+    {
+        --offset;
+    }
+    while (offset > 0 && IsUtf8Continuation(data[offset]));
+    return offset;
+}
+
+// Byte offset of the code point with the given index, counted from the beginning
+inline SizeType Utf8ByteOffset(const char* data, const SizeType size, const SizeType index)
+{
+    SizeType offset = 0;
+
+    for (SizeType i = 0; i < index && offset < size; ++i)
+    {
+        offset = Utf8NextOffset(data, offset);
+    }
+    return offset;
+}
+
+inline CodePoint DecodeUtf8(const char* data)
+{
+    const auto lead = static_cast<Byte>(data[0]);
+
+    switch (Utf8SequenceLength(data[0]))
+    {
+        case 1:
+            return lead;
+        case 2:
+            return (lead & 0x1F) << 6 | (static_cast<Byte>(data[1]) & 0x3F);
+        case 3:
+            return (lead & 0x0F) << 12 | (static_cast<Byte>(data[1]) & 0x3F) << 6 |
+                   (static_cast<Byte>(data[2]) & 0x3F);
+        case 4:
+            return (lead & 0x07) << 18 | (static_cast<Byte>(data[1]) & 0x3F) << 12 |
+                   (static_cast<Byte>(data[2]) & 0x3F) << 6 | (static_cast<Byte>(data[3]) & 0x3F);
+        default:
+            return 0;
+    }
+}
+
+// Writes the encoded code point into the buffer and returns the number of bytes written
+inline SizeType EncodeUtf8(const CodePoint codePoint, char* buffer)
+{
+    if (codePoint < 0x80)
+    {
+        buffer[0] = static_cast<char>(codePoint);
+        return 1;
+    }
+    if (codePoint < 0x800)
+    {
+        buffer[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+        buffer[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+        return 2;
+    }
+    if (codePoint < 0x10000)
+    {
+        buffer[0] = static_cast<char>(0xE0 | (codePoint >> 12));
+        buffer[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        buffer[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+        return 3;
+    }
+    buffer[0] = static_cast<char>(0xF0 | (codePoint >> 18));
+    buffer[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+    buffer[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+    buffer[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+    return 4;
+}
+
+__CAITLYN_DETAIL_NAMESPACE_END
+__CAITLYN_GLOBAL_NAMESPACE_END
+
+#endif // CAITLYN_CORE_STRING_UTF8_H_
@@ -19,27 +19,83 @@
 #define CAITLYN_CORE_STRING_UTILITY_H_
 
 #include <algorithm>
+#include <cstring>
 #include <sstream>
 
+#include "Caitlyn/__Core/String/Classify.h"
+#include "Caitlyn/__Core/String/Split.h"
 #include "Caitlyn/__Core/String/String.h"
+#include "Caitlyn/__Core/String/StringView.h"
 #include "Caitlyn/__Core/Traits/Types/Base.h"
 #include "Caitlyn/__Core/Traits/Types/Primary.h"
 
 __CAITLYN_GLOBAL_NAMESPACE_BEGIN
 
+// Splits raw bytes like std::getline does, a trailing delimiter does not add an empty item
 inline std::vector<std::string> Split(const std::string& text, const char delim)
 {
-    std::stringstream ss{text};
-    std::string item;
     std::vector<std::string> data;
+    const char* first = text.data();
+    const char* const last = first + text.size();
 
-    while (std::getline(ss, item, delim))
+    while (first != last)
     {
-        data.emplace_back(item);
+        const auto found = static_cast<const char*>(std::memchr(first, delim, static_cast<SizeType>(last - first)));
+
+        if (found == nullptr)
+        {
+            data.emplace_back(first, last);
+            break;
+        }
+        data.emplace_back(first, found);
+        first = found + 1;
+    }
+    return data;
+}
+
+// Splits the text into views of its bytes without copying the tokens
+inline std::vector<StringView> SplitView(const StringView& text, const StringView& delimiter)
+{
+    std::vector<StringView> data;
+
+    if (delimiter.IsEmpty())
+    {
+        if (text.NotEmpty())
+        {
+            data.emplace_back(text);
+        }
+        return data;
+    }
+    SizeType first = 0;
+
+    while (first < text.ByteCount())
+    {
+        SizeType last =
+            __Detail::FindBytes(text.data(), text.ByteCount(), delimiter.data(), delimiter.ByteCount(), first);
+
+        if (last == __Detail::NotFound)
+        {
+            last = text.ByteCount();
+        }
+        data.emplace_back(text.data() + first, last - first);
+        first = last + delimiter.ByteCount();
     }
     return data;
 }
 
+// Number of leading code points of the class
+inline SizeType SkipWhile(const StringView& text, const CharClass charClass)
+{
+    const SizeType offset = __Detail::SkipClass(text.data(), text.ByteCount(), static_cast<UInt8>(charClass));
+    return text.IsAscii() ? offset : __Detail::CountUtf8CodePoints(text.data(), offset);
+}
+
+// Number of code points of the class in the text
+inline SizeType CountIf(const StringView& text, const CharClass charClass)
+{
+    return __Detail::CountClass(text.data(), text.ByteCount(), static_cast<UInt8>(charClass));
+}
+
 inline std::string Repeat(const std::string& str, const size_t count)
 {
     if (count < 2)
@@ -148,20 +204,12 @@ inline String EscapeString(const String& str)
 
 inline bool IsNumber(const String& str)
 {
-    return str.NotEmpty() &&
-           std::all_of(str.begin(), str.end(), [](const Char& c) { return IsDigit(c.GetCodePoint()); });
+    return str.NotEmpty() && SkipWhile(str, CharClass::Digit) == str.Length();
 }
 
 inline size_t FindFirstNonSpace(const String& str)
 {
-    for (size_t i = 0; i < str.size(); ++i)
-    {
-        if (!IsSpace(str[i].GetCodePoint()))
-        {
-            return i;
-        }
-    }
-    return str.size();
+    return SkipWhile(str, CharClass::Space);
 }
 
 inline size_t FindLastNonSpace(const String& str)
@@ -450,11 +450,21 @@ private:
                 oss << Def::QuotationMark << data_.string_value << Def::QuotationMark;
                 break;
             case JsonClass::Floating:
-                oss << data_.floating_value;
+            {
+                // Shortest text that parses back to the same value
+                char digits[32];
+                const SizeType count = ::Caitlyn::__Detail::WriteShortest(data_.floating_value, digits);
+                oss.write(digits, static_cast<std::streamsize>(count));
                 break;
+            }
             case JsonClass::Integral:
-                oss << data_.integral_value;
+            {
+                char digits[24];
+                char* const end = digits + sizeof(digits);
+                const char* begin = ::Caitlyn::__Detail::WriteSignedDecimalBackward(end, data_.integral_value);
+                oss.write(begin, end - begin);
                 break;
+            }
             case JsonClass::Boolean:
                 oss << (data_.boolean_value ? String::ValueOf(true) : String::ValueOf(false));
                 break;
@@ -404,9 +404,9 @@ private:
 
     void SkipSpace()
     {
-        while (position_ < json_.size() && IsSpace(json_[position_].GetCodePoint()))
+        if (position_ < json_.size())
         {
-            Next();
+            Next(SkipWhile(json_.SubstringView(position_), CharClass::Space));
         }
     }
 
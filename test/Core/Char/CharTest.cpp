@@ -1,7 +1,104 @@
+#include <stdexcept>
+
 #include "Caitlyn/__Core/Char.h"
 #include "Caitlyn/__Testing/Macro.h"
 
+template <typename... Args>
+static bool IsRejected(const Args&... args)
+{
+    try
+    {
+        Caitlyn::Char value{args...};
+    }
+    catch (const std::invalid_argument&)
+    {
+        return true;
+    }
+    return false;
+}
+
 TEST(CharTest, Sample)
 {
     PASS();
 }
+
+TEST(CharTest, CaseMapping)
+{
+    ASSERT_EQ(0x0041, Caitlyn::ToUppercase(0x0061));
+    ASSERT_EQ(0x0410, Caitlyn::ToUppercase(0x0430));
+    ASSERT_EQ(0x0049, Caitlyn::ToUppercase(0x0131));
+    ASSERT_EQ(0x1E9E, Caitlyn::ToUppercase(0x00DF));
+    ASSERT_EQ(0x10A0, Caitlyn::ToUppercase(0x2D00));
+    ASSERT_EQ(0x1E900, Caitlyn::ToUppercase(0x1E922));
+    ASSERT_EQ(0x0069, Caitlyn::ToLowercase(0x0130));
+    ASSERT_EQ(0x006B, Caitlyn::ToLowercase(0x212A));
+    ASSERT_EQ(0x0561, Caitlyn::ToLowercase(0x0531));
+    ASSERT_EQ(0x4E16, Caitlyn::ToLowercase(0x4E16));
+    ASSERT_EQ(0x10FFFF, Caitlyn::ToUppercase(0x10FFFF));
+}
+
+TEST(CharTest, Classification)
+{
+    ASSERT_TRUE(Caitlyn::IsSpace(0x0020));
+    ASSERT_TRUE(Caitlyn::IsSpace(0x000D));
+    ASSERT_TRUE(Caitlyn::IsSpace(0x3000));
+    ASSERT_FALSE(Caitlyn::IsSpace(0x200B));
+    ASSERT_FALSE(Caitlyn::IsSpace(0x1F600));
+    ASSERT_TRUE(Caitlyn::IsDigit(0x0037));
+    ASSERT_TRUE(Caitlyn::IsDigit(0x0966));
+    ASSERT_TRUE(Caitlyn::IsDigit(0xFF19));
+    ASSERT_FALSE(Caitlyn::IsDigit(0x003A));
+    ASSERT_FALSE(Caitlyn::IsDigit(0x00B2));
+}
+
+TEST(CharTest, CasePredicates)
+{
+    ASSERT_TRUE(Caitlyn::IsUppercase(0x00C0));
+    ASSERT_TRUE(Caitlyn::IsUppercase(0x1E9E));
+    ASSERT_TRUE(Caitlyn::IsUppercase(0x10A0));
+    ASSERT_TRUE(Caitlyn::IsLowercase(0x00E0));
+    ASSERT_TRUE(Caitlyn::IsLowercase(0x00B5));
+    ASSERT_TRUE(Caitlyn::IsLowercase(0x0149));
+    ASSERT_FALSE(Caitlyn::IsUppercase(0x0061));
+    ASSERT_FALSE(Caitlyn::IsLowercase(0x0041));
+    ASSERT_FALSE(Caitlyn::IsLetter(0x0031));
+    ASSERT_TRUE(Caitlyn::IsLetter(0x0561));
+
+    for (Caitlyn::CodePoint codePoint = 0; codePoint < 0x20000; ++codePoint)
+    {
+        if (Caitlyn::ToLowercase(codePoint) != codePoint)
+        {
+            ASSERT_TRUE(Caitlyn::IsUppercase(codePoint));
+        }
+        if (Caitlyn::ToUppercase(codePoint) != codePoint)
+        {
+            ASSERT_TRUE(Caitlyn::IsLowercase(codePoint));
+        }
+    }
+}
+
+TEST(CharTest, Validation)
+{
+    ASSERT_EQ(2, Caitlyn::Char("\xC3\xA9").size());
+    ASSERT_EQ(1, Caitlyn::Char('a').size());
+    ASSERT_TRUE(IsRejected('\xF0'));
+    ASSERT_TRUE(IsRejected("\xF0"));
+    ASSERT_TRUE(IsRejected("\xC0\x80"));
+    ASSERT_TRUE(IsRejected("\xED\xA0\x80"));
+    ASSERT_TRUE(IsRejected("\xF4\x90\x80\x80"));
+    ASSERT_TRUE(IsRejected(static_cast<Caitlyn::CodePoint>(0xD800)));
+    ASSERT_TRUE(IsRejected(static_cast<Caitlyn::CodePoint>(0x110000)));
+
+    Caitlyn::Char value;
+    bool thrown = false;
+    try
+    {
+        value = '\x80';
+    }
+    catch (const std::invalid_argument&)
+    {
+        thrown = true;
+    }
+    ASSERT_TRUE(thrown);
+    ASSERT_TRUE(value.IsEmpty());
+}
@@ -0,0 +1,262 @@
+#include <cstdint>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+#include "Caitlyn/__Core/String.h"
+#include "Caitlyn/__Testing/Macro.h"
+
+static_assert(Caitlyn::IsValidFormat("{} {1} {{}}", 2), "");
+static_assert(Caitlyn::IsValidFormat("{0:*^10.2f}", 1), "");
+static_assert(!Caitlyn::IsValidFormat("{2}", 2), "");
+static_assert(!Caitlyn::IsValidFormat("{} {", 1), "");
+static_assert(!Caitlyn::IsValidFormat("}", 0), "");
+static_assert(!Caitlyn::IsValidFormat("{}", 0), "");
+static_assert(!Caitlyn::IsValidFormat("{:>5q}", 1), "");
+static_assert(!Caitlyn::IsValidFormat("{:#d}", 1), "");
+
+// The plain mask marks text and floating-point arguments, which take no representation or grouping
+static_assert(decltype(Caitlyn::__Detail::PlainFormatArguments("", 1, 2.5, "s", 'c', true))::value == 0x16, "");
+static_assert(Caitlyn::IsValidFormat("{:#x} {:,}", 2, 0), "");
+static_assert(!Caitlyn::IsValidFormat("{:x}", 1, 1), "");
+static_assert(!Caitlyn::IsValidFormat("{0} {1:_.2f}", 2, 2), "");
+static_assert(!Caitlyn::IsValidFormat("{1:>8b}", 2, 2), "");
+static_assert(Caitlyn::IsValidFormat("{:x^8} {:,.2f}", 2, 1), "");
+static_assert(Caitlyn::IsValidFormat("{:ё<8.3}", 1, 1), "");
+
+// Literal text is checked in blocks, long patterns stay within the compile-time recursion limit
+#define FORMAT_TEST_TEXT_64 "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do."
+#define FORMAT_TEST_TEXT_1K                                                                                    \
+    FORMAT_TEST_TEXT_64 FORMAT_TEST_TEXT_64 FORMAT_TEST_TEXT_64 FORMAT_TEST_TEXT_64 FORMAT_TEST_TEXT_64        \
+        FORMAT_TEST_TEXT_64 FORMAT_TEST_TEXT_64 FORMAT_TEST_TEXT_64 FORMAT_TEST_TEXT_64 FORMAT_TEST_TEXT_64    \
+            FORMAT_TEST_TEXT_64 FORMAT_TEST_TEXT_64 FORMAT_TEST_TEXT_64 FORMAT_TEST_TEXT_64 FORMAT_TEST_TEXT_64 \
+                FORMAT_TEST_TEXT_64
+#define FORMAT_TEST_TEXT_8K                                                                                    \
+    FORMAT_TEST_TEXT_1K FORMAT_TEST_TEXT_1K FORMAT_TEST_TEXT_1K FORMAT_TEST_TEXT_1K FORMAT_TEST_TEXT_1K        \
+        FORMAT_TEST_TEXT_1K FORMAT_TEST_TEXT_1K FORMAT_TEST_TEXT_1K
+
+static_assert(Caitlyn::IsValidFormat(FORMAT_TEST_TEXT_8K, 0), "");
+static_assert(Caitlyn::IsValidFormat(FORMAT_TEST_TEXT_8K "{}" FORMAT_TEST_TEXT_8K "{{", 1), "");
+static_assert(!Caitlyn::IsValidFormat(FORMAT_TEST_TEXT_8K "}" FORMAT_TEST_TEXT_1K, 0), "");
+static_assert(!Caitlyn::IsValidFormat(FORMAT_TEST_TEXT_1K "{}" FORMAT_TEST_TEXT_8K "{:x}", 1, 1), "");
+
+namespace
+{
+template <typename... Args>
+bool ThrowsFormatError(const char* pattern, const Args&... args)
+{
+    try
+    {
+        Caitlyn::String::Format(pattern, args...);
+    }
+    catch (const Caitlyn::FormatError&)
+    {
+        return true;
+    }
+    return false;
+}
+
+bool ThrowsFormatError(const char* pattern)
+{
+    return ThrowsFormatError(pattern, 1, 2);
+}
+}
+
+TEST(FormatTest, Pattern)
+{
+    const Caitlyn::FormatString format{"{}: {:>5}|{{x}}"};
+
+    ASSERT_EQ(5, format.Segments().size());
+    ASSERT_EQ("key:     7|{x}"_str, Caitlyn::String::Format(format, "key", 7));
+    ASSERT_EQ("a:     b|{x}"_str, Caitlyn::String::Format(format, "a", "b"));
+    ASSERT_TRUE(&Caitlyn::FormatString::Cached("{} {}") == &Caitlyn::FormatString::Cached("{} {}"));
+}
+
+TEST(FormatTest, Arguments)
+{
+    ASSERT_EQ("x, x"_str, Caitlyn::String::Format("{}, {}", "x"));
+    ASSERT_EQ("2 1"_str, Caitlyn::String::Format("{1} {0}", 1, 2));
+    ASSERT_EQ("    2|1"_str, Caitlyn::String::Format("{1:>5}|{0}", 1, 2));
+    ASSERT_EQ("1|   2   "_str, Caitlyn::String::Format("{}|{:^7}", 1, 2));
+    ASSERT_EQ("·ключ·"_str, Caitlyn::String::Format("{:·^6}", "ключ"));
+    ASSERT_EQ("3.14"_str, Caitlyn::String::Format("{:.2f}", 3.14159));
+}
+
+TEST(FormatTest, Errors)
+{
+    ASSERT_TRUE(ThrowsFormatError("{} {"));
+    ASSERT_TRUE(ThrowsFormatError("}"));
+    ASSERT_TRUE(ThrowsFormatError("{5}"));
+    ASSERT_TRUE(ThrowsFormatError("{0x}"));
+    ASSERT_TRUE(ThrowsFormatError("{:>5q}"));
+    ASSERT_FALSE(ThrowsFormatError("{1} {0}"));
+
+    bool thrown = false;
+    try
+    {
+        Caitlyn::String::Format("{1}", 1);
+    }
+    catch (const Caitlyn::String::Formatter::FormatError&)
+    {
+        thrown = true;
+    }
+    ASSERT_TRUE(thrown);
+    ASSERT_TRUE((std::is_same<Caitlyn::String::FormatError, Caitlyn::FormatError>::value));
+}
+
+TEST(FormatTest, UnsupportedSpecifiers)
+{
+    ASSERT_TRUE(ThrowsFormatError("{:x}", 1.5));
+    ASSERT_TRUE(ThrowsFormatError("{:#b}", 2.0f));
+    ASSERT_TRUE(ThrowsFormatError("{:,}", 1234.5));
+    ASSERT_TRUE(ThrowsFormatError("{:o}", "text"));
+    ASSERT_TRUE(ThrowsFormatError("{:_}", Caitlyn::String{"text"}));
+    ASSERT_TRUE(ThrowsFormatError("{:X}", true));
+    ASSERT_FALSE(ThrowsFormatError("{:x} {:,}", 255, 1234));
+    ASSERT_FALSE(ThrowsFormatError("{:x^6.2f}", 1.5));
+}
+
+TEST(FormatTest, Checked)
+{
+    const Caitlyn::String name = "world";
+
+    ASSERT_EQ("Hello, world!"_str, CAITLYN_FORMAT("Hello, {}!", name));
+    ASSERT_EQ("[  42]"_str, CAITLYN_FORMAT("[{:>4}]", 42));
+    ASSERT_EQ("{}"_str, CAITLYN_FORMAT("{{}}"));
+    ASSERT_EQ(8195, CAITLYN_FORMAT(FORMAT_TEST_TEXT_8K "{}", 123).ByteCount());
+}
+
+TEST(FormatTest, FormatTo)
+{
+    Caitlyn::String text = "id=";
+    text.AppendFormat("{:0>4}, {}", 42, "ok");
+    ASSERT_EQ("id=0042, ok"_str, text);
+    ASSERT_EQ(11, text.Length());
+
+    std::string bytes;
+    Caitlyn::FormatTo(std::back_inserter(bytes), "{} {:.2f} {}", -7, 2.5, true);
+    ASSERT_EQ(std::string{"-7 2.50 true"}, bytes);
+
+    std::ostringstream stream;
+    Caitlyn::FormatTo(stream, "[{:*^8}]", "мир");
+    ASSERT_EQ(std::string{"[**мир***]"}, stream.str());
+
+    const Caitlyn::String long_text(1000, 'x');
+    Caitlyn::String target;
+    Caitlyn::FormatTo(target, "{}{}", long_text, long_text);
+    ASSERT_EQ(2000, target.ByteCount());
+    ASSERT_EQ(2000, Caitlyn::FormattedSize("{}{}", long_text, long_text));
+    ASSERT_EQ(Caitlyn::String::Format("{:>9} {}", 3.25, 'c').ByteCount(), Caitlyn::FormattedSize("{:>9} {}", 3.25, 'c'));
+}
+
+TEST(FormatTest, FixedBuffer)
+{
+    char data[8];
+    Caitlyn::FixedFormatBuffer buffer{data};
+    Caitlyn::FormatTo(buffer, "{}-{}", 123, "ёж");
+
+    ASSERT_EQ(8, buffer.Size());
+    ASSERT_FALSE(buffer.IsTruncated());
+    ASSERT_EQ(std::string{"123-ёж"}, std::string(buffer.data(), buffer.Size()));
+
+    char small[6];
+    Caitlyn::FixedFormatBuffer truncated{small};
+    Caitlyn::FormatTo(truncated, "{}-{}", 123, "ёж");
+
+    ASSERT_TRUE(truncated.IsTruncated());
+    ASSERT_EQ(6, truncated.Size());
+    ASSERT_EQ(8, truncated.TotalSize());
+
+    char tiny[5];
+    Caitlyn::FixedFormatBuffer split{tiny};
+    Caitlyn::FormatTo(split, "{}-{}", 123, "ёж");
+    ASSERT_EQ(4, split.Size());
+}
+
+TEST(FormatTest, FailedFormatKeepsString)
+{
+    Caitlyn::String text = "kept";
+    bool thrown = false;
+
+    try
+    {
+        text.AppendFormat("{} {5}", Caitlyn::String(100, 'x'), 1);
+    }
+    catch (const Caitlyn::FormatError&)
+    {
+        thrown = true;
+    }
+    ASSERT_TRUE(thrown);
+    ASSERT_EQ("kept"_str, text);
+    ASSERT_EQ(4, text.ByteCount());
+}
+
+TEST(FormatTest, Numbers)
+{
+    ASSERT_EQ("-9223372036854775808 18446744073709551615 0"_str,
+              Caitlyn::String::Format("{} {} {}", INT64_MIN, UINT64_MAX, 0));
+    ASSERT_EQ("1.5 0.30000000000000004 1e+21 123456 -0 0.1"_str,
+              Caitlyn::String::Format("{} {} {} {} {} {}", 1.5, 0.1 + 0.2, 1e21, 123456.0, -0.0, 0.1f));
+    ASSERT_EQ("5e-324 1.7976931348623157e+308 inf"_str,
+              Caitlyn::String::Format("{} {} {}", 5e-324, 1.7976931348623157e308, 1.0 / 0.0));
+    ASSERT_EQ("[2] [2.67] [1.500000] [    -3.142] [0.1]"_str,
+              Caitlyn::String::Format("[{:.0f}] [{:.2f}] [{:f}] [{:>10.3f}] [{:.1}]", 2.5, 2.675, 1.5, -3.14159, 0.05));
+    ASSERT_EQ("0.1000000000000000055511151"_str, Caitlyn::String::Format("{:.25f}", 0.1));
+    ASSERT_EQ("12.00"_str, Caitlyn::String::Format("{:.2f}", 12));
+}
+
+TEST(FormatTest, Radix)
+{
+    ASSERT_EQ("ff FF 0xff 0XFF 377 0377 1010 0b1010 0"_str,
+              Caitlyn::String::Format("{:x} {:X} {:#x} {:#X} {:o} {:#o} {:b} {:#b} {:#o}", 255, 255, 255, 255, 255,
+                                      255, 10, 10, 0));
+    ASSERT_EQ("-0x80 ffffffffffffffff 1000000000000000000000000000000000000000000000000000000000000000"_str,
+              Caitlyn::String::Format("{:#x} {:x} {:b}", -128, UINT64_MAX, 1ULL << 63));
+    ASSERT_EQ("[0x0000002a] [-0042] [42    ] [  0b101]"_str,
+              Caitlyn::String::Format("[{:#010x}] [{:05}] [{:<6o}] [{:>#7b}]", 42, -42, 34, 5));
+    ASSERT_EQ("1,234,567 -1_000 dead_beef 1111_0000 01,234"_str,
+              Caitlyn::String::Format("{:,} {:_} {:_x} {:_b} {:06,}", 1234567, -1000, 0xDEADBEEFU, 240, 1234));
+    ASSERT_EQ("[-0003.14] [00002.5]"_str, Caitlyn::String::Format("[{:08.2f}] [{:07}]", -3.14159, 2.5));
+
+    bool thrown = false;
+
+    try
+    {
+        Caitlyn::String::Format("{:#}", 1);
+    }
+    catch (const Caitlyn::FormatError&)
+    {
+        thrown = true;
+    }
+    ASSERT_TRUE(thrown);
+}
+
+TEST(FormatTest, HexBytes)
+{
+    const unsigned char digest[] = {0xDE, 0xAD, 0xBE, 0xEF, 0x00, 0x01};
+
+    ASSERT_EQ("deadbeef0001"_str, Caitlyn::HexBytes(digest, sizeof(digest)).ToString());
+    ASSERT_EQ("[0XDEADBEEF0001] [  6162  ]"_str,
+              Caitlyn::String::Format("[{:#X}] [{:^8}]", Caitlyn::HexBytes(digest, sizeof(digest)),
+                                      Caitlyn::HexBytes(Caitlyn::StringView{"ab"})));
+
+    const Caitlyn::String dump = Caitlyn::HexDump(Caitlyn::StringView{"Hello, world!\n\x01 bytes"}).ToString();
+    ASSERT_EQ("00000000  48 65 6c 6c 6f 2c 20 77  6f 72 6c 64 21 0a 01 20  |Hello, world!.. |\n"
+              "00000010  62 79 74 65 73                                    |bytes|\n"_str,
+              dump);
+    ASSERT_EQ("00001000  0A                                                |.|\n"_str,
+              Caitlyn::String::Format("{:X}", Caitlyn::HexDump("\n", 1, 0x1000)));
+}
+
+TEST(FormatTest, CharReference)
+{
+    Caitlyn::String data = "aжb";
+
+    ASSERT_EQ("[ж] [b]"_str, Caitlyn::String::Format("[{}] [{}]", data[1], data.At(2)));
+    ASSERT_EQ("[ ж ]"_str, Caitlyn::String::Format("[{:^3}]", data.At(1)));
+
+    Caitlyn::StringBuilder builder;
+    builder.Append("{}{}", data[0], data.At(1));
+    ASSERT_EQ("aж"_str, builder.str());
+}
@@ -0,0 +1,47 @@
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "Caitlyn/__Core/String.h"
+#include "Caitlyn/__Testing/Macro.h"
+
+TEST(ImmutableStringTest, Sharing)
+{
+    const Caitlyn::ImmutableString key = "database.primary.host — основной";
+    const Caitlyn::ImmutableString copy = key;
+
+    ASSERT_EQ(key.data(), copy.data());
+    ASSERT_EQ(2, key.UseCount());
+    ASSERT_EQ(key.Hash(), Caitlyn::ImmutableString{key.ToString()}.Hash());
+    ASSERT_TRUE(copy == "database.primary.host — основной");
+    ASSERT_EQ(Caitlyn::Char{"о"}, key[24]);
+    ASSERT_TRUE(key.StartsWith("database"));
+    ASSERT_TRUE(Caitlyn::ImmutableString{}.IsEmpty());
+
+    std::unordered_set<Caitlyn::ImmutableString> keys{key, copy, "other"};
+    ASSERT_EQ(2, keys.size());
+}
+
+TEST(ImmutableStringTest, Threads)
+{
+    const Caitlyn::ImmutableString value = "shared configuration value";
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back(
+            [&value]
+            {
+                for (int j = 0; j < 10000; ++j)
+                {
+                    const Caitlyn::ImmutableString copy = value;
+                    (void)copy.Hash();
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    ASSERT_EQ(1, value.UseCount());
+}
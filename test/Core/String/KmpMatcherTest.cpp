@@ -0,0 +1,40 @@
+#include <string>
+#include <vector>
+
+#include "Caitlyn/__Core/String.h"
+#include "Caitlyn/__Testing/Macro.h"
+
+TEST(KmpMatcherTest, Chunks)
+{
+    Caitlyn::KmpMatcher matcher{"abcab"};
+    std::vector<Caitlyn::SizeType> offsets;
+
+    for (const std::string chunk : {"xxab", "ca", "bcab", "", "y"})
+    {
+        matcher.Feed(chunk.data(), chunk.size(), [&offsets](Caitlyn::SizeType offset) { offsets.push_back(offset); });
+    }
+    ASSERT_EQ(2, offsets.size());
+    ASSERT_EQ(2, offsets[0]);
+    ASSERT_EQ(5, offsets[1]);
+    ASSERT_EQ(11, matcher.Consumed());
+
+    matcher.Reset();
+    ASSERT_EQ(0, matcher.Consumed());
+    ASSERT_TRUE(matcher.Feed("cab").empty());
+}
+
+TEST(KmpMatcherTest, FindAll)
+{
+    const Caitlyn::KmpMatcher matcher{"aa"};
+    const auto offsets = matcher.FindAll("aaaba");
+
+    ASSERT_EQ(2, offsets.size());
+    ASSERT_EQ(0, offsets[0]);
+    ASSERT_EQ(1, offsets[1]);
+    ASSERT_EQ(1, matcher.Find("baa", 3));
+    ASSERT_EQ(Caitlyn::KmpMatcher::NPosition, matcher.Find("aba", 3));
+    ASSERT_TRUE(Caitlyn::KmpMatcher{""}.FindAll("abc").empty());
+
+    ASSERT_TRUE(Caitlyn::kmp("needle", "haystack with a needle"));
+    ASSERT_FALSE(Caitlyn::kmp("needle", "haystack"));
+}
@@ -0,0 +1,55 @@
+#include <vector>
+
+#include "Caitlyn/__Core/String.h"
+#include "Caitlyn/__Testing/Macro.h"
+
+TEST(MultiMatcherTest, FindAll)
+{
+    const Caitlyn::MultiMatcher matcher{"he", "she", "his", "hers", "мир"};
+    const auto matches = matcher.FindAll("ushers в мире");
+
+    ASSERT_EQ(4, matches.size());
+    ASSERT_EQ(1, matches[0].pattern);
+    ASSERT_EQ(1, matches[0].position);
+    ASSERT_EQ(0, matches[1].pattern);
+    ASSERT_EQ(2, matches[1].position);
+    ASSERT_EQ(3, matches[2].pattern);
+    ASSERT_EQ(2, matches[2].position);
+    ASSERT_EQ(4, matches[3].pattern);
+    ASSERT_EQ(9, matches[3].position);
+    ASSERT_EQ(3, matches[3].length);
+    ASSERT_EQ(10, matches[3].offset);
+    ASSERT_EQ(6, matches[3].size);
+
+    ASSERT_TRUE(matcher.ContainsAny("this"));
+    ASSERT_FALSE(matcher.ContainsAny("nothing to see"));
+}
+
+TEST(MultiMatcherTest, Duplicates)
+{
+    const std::vector<Caitlyn::String> patterns{"token", "", "token", "ok"};
+    const Caitlyn::MultiMatcher matcher{patterns};
+    std::vector<Caitlyn::SizeType> found;
+
+    matcher.Scan("a token", [&found](const Caitlyn::MultiMatch& match) { found.push_back(match.pattern); });
+    ASSERT_EQ(4, matcher.Size());
+    ASSERT_EQ(3, found.size());
+    ASSERT_EQ(3, found[0]);
+    ASSERT_EQ(0, found[1]);
+    ASSERT_EQ(2, found[2]);
+}
+
+TEST(MultiMatcherTest, IgnoreCase)
+{
+    const Caitlyn::MultiMatcher matcher{{"password", "Секрет", "kelvin"}, Caitlyn::CaseMode::Insensitive};
+    const Caitlyn::String text = "PassWord=1; сЕКРЕТ; Kelvin";
+    const auto matches = matcher.FindAll(text);
+
+    ASSERT_EQ(3, matches.size());
+    ASSERT_EQ(0, matches[0].position);
+    ASSERT_EQ(12, matches[1].position);
+    ASSERT_EQ(20, matches[2].position);
+    ASSERT_EQ("Kelvin"_str, text.Substring(matches[2].position, matches[2].length));
+    ASSERT_EQ(8, matches[2].size);
+    ASSERT_FALSE(Caitlyn::MultiMatcher({"password"}).ContainsAny(text));
+}
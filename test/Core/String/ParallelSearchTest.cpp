@@ -0,0 +1,31 @@
+#include "Caitlyn/__Core/String.h"
+#include "Caitlyn/__Testing/Macro.h"
+
+TEST(ParallelSearchTest, Chunks)
+{
+    // Large enough to be cut into four chunks, occurrences cross the cuts
+    constexpr Caitlyn::SizeType count = 100000;
+    Caitlyn::StringBuilder builder;
+
+    for (Caitlyn::SizeType i = 0; i < count; ++i)
+    {
+        builder.Append("жж needle ");
+    }
+    builder.Append("end");
+    const Caitlyn::String text = builder.Release();
+
+    ASSERT_EQ(3, Caitlyn::ParallelFind(text, "needle", 4));
+    ASSERT_EQ(count * 10, Caitlyn::ParallelFind(text, "end", 4));
+    ASSERT_EQ(Caitlyn::String::NPosition, Caitlyn::ParallelFind(text, "needle жжж", 4));
+    ASSERT_EQ(count, Caitlyn::ParallelCount(text, "needle", 4));
+    ASSERT_EQ(count - 1, Caitlyn::ParallelCount(text, "needle жж", 4));
+
+    const auto positions = Caitlyn::ParallelFindAll(text, "e жж n", 4);
+    ASSERT_EQ(count - 1, positions.size());
+
+    for (Caitlyn::SizeType i = 0; i < positions.size(); ++i)
+    {
+        ASSERT_EQ(8 + i * 10, positions[i]);
+    }
+    ASSERT_EQ(text.Find("le жж"), Caitlyn::ParallelFind(text, "le жж"));
+}
@@ -0,0 +1,66 @@
+#include "Caitlyn/__Core/String.h"
+#include "Caitlyn/__Testing/Macro.h"
+
+TEST(RopeTest, Edit)
+{
+    Caitlyn::Rope rope = "Hello, world!";
+
+    rope.Insert(7, "дивный ");
+    ASSERT_TRUE(rope == "Hello, дивный world!");
+    rope.Erase(0, 7);
+    ASSERT_TRUE(rope == "дивный world!");
+    ASSERT_EQ(13, rope.Length());
+    ASSERT_EQ(Caitlyn::Char{"й"}, rope[5]);
+    ASSERT_TRUE(rope.Substring(7, 5) == "world");
+    ASSERT_TRUE((rope + " 🙂").ToString() == "дивный world! 🙂");
+    ASSERT_TRUE(rope.View() == "дивный world!");
+}
+
+TEST(RopeTest, LargeDocument)
+{
+    const Caitlyn::String line = "<p>{{ name }} — ok</p>\n";
+    Caitlyn::Rope document;
+
+    for (int i = 0; i < 4096; ++i)
+    {
+        document += line;
+    }
+    const Caitlyn::SizeType length = document.Length();
+
+    for (Caitlyn::SizeType pos = 0; pos < 200; ++pos)
+    {
+        document.Insert(pos * 97, "é");
+    }
+    ASSERT_EQ(length + 200, document.Length());
+    ASSERT_LE(document.Depth(), 20);
+
+    for (Caitlyn::SizeType pos = 0; pos < 200; ++pos)
+    {
+        ASSERT_EQ(Caitlyn::Char{"é"}, document[pos * 97]);
+    }
+    for (Caitlyn::SizeType pos = 0; pos < 200; ++pos)
+    {
+        document.Erase(pos * 96, 1);
+    }
+    ASSERT_EQ(length, document.Length());
+    ASSERT_TRUE(document.Substring(line.Length(), line.Length()) == line);
+}
+
+TEST(RopeTest, Equality)
+{
+    Caitlyn::Rope left = "Привет";
+    left += ", ";
+    left += "мир!";
+    Caitlyn::Rope right = "При";
+    right += "вет, м";
+    right += "ир!";
+
+    ASSERT_TRUE(left == right);
+    ASSERT_TRUE(left == Caitlyn::Rope{"Привет, мир!"});
+    ASSERT_TRUE(Caitlyn::Rope{} == Caitlyn::Rope{""});
+
+    right.Erase(11);
+    right += "?";
+    ASSERT_TRUE(left != right);
+    ASSERT_TRUE(left != Caitlyn::Rope{"Привет"});
+}
@@ -0,0 +1,101 @@
+#include "Caitlyn/__Core/String.h"
+#include "Caitlyn/__Testing/Macro.h"
+
+TEST(StringBuilderTest, Append)
+{
+    auto text = Caitlyn::MakeText("Text: ");
+    text.Append("Lorem ipsum, ");
+    text.AppendLine("世界");
+    text.AppendLine("{} + {} = {}", 2, 3, 5);
+    text.AppendFormat("[{:>4}]", "ё");
+
+    ASSERT_EQ("Text: Lorem ipsum, 世界\n2 + 3 = 5\n[   ё]"_str, text.str());
+    ASSERT_EQ(38, text.Length());
+    ASSERT_EQ("<Text: Lorem ipsum, 世界\n2 + 3 = 5\n[   ё]>"_str, Caitlyn::String::Format("<{}>", text));
+}
+
+TEST(StringBuilderTest, Capacity)
+{
+    Caitlyn::StringBuilder builder;
+    builder.Reserve(256);
+    ASSERT_TRUE(builder.Capacity() >= 256);
+
+    builder.AppendFormat("{}-{}", "report", 1);
+    const char* data = builder.View().data();
+    builder.Clear();
+    ASSERT_TRUE(builder.IsEmpty());
+    ASSERT_TRUE(builder.Capacity() >= 256);
+
+    builder.Append("row");
+    ASSERT_TRUE(builder.View().data() == data);
+
+    const Caitlyn::String released = builder.Release();
+    ASSERT_TRUE(released.data() == data);
+    ASSERT_EQ("row"_str, released);
+    ASSERT_TRUE(builder.IsEmpty());
+    ASSERT_EQ(0, builder.ByteCount());
+}
+
+TEST(StringBuilderTest, AppendLineGrowth)
+{
+    Caitlyn::StringBuilder builder;
+    Caitlyn::SizeType capacity = builder.Capacity();
+    int reallocations = 0;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        builder.AppendLine("log line");
+
+        if (builder.Capacity() != capacity)
+        {
+            // The buffer grows geometrically instead of to the exact size of every line
+            ASSERT_TRUE(builder.Capacity() >= capacity * 2);
+            capacity = builder.Capacity();
+            ++reallocations;
+        }
+    }
+    ASSERT_EQ(9000, builder.ByteCount());
+    ASSERT_LE(reallocations, 10);
+}
+
+TEST(StringBuilderTest, Pooled)
+{
+    Caitlyn::StringBuilderPool::Trim();
+    const auto before = Caitlyn::StringBuilderPool::Stats();
+    const char* data = nullptr;
+    {
+        auto text = Caitlyn::MakePooledText("request {}: ", 1);
+        text.Append(Caitlyn::String(100, 'x'));
+        data = text.View().data();
+    }
+    ASSERT_EQ(0, before.retained_bytes);
+    ASSERT_TRUE(Caitlyn::StringBuilderPool::Stats().retained_bytes >= 111);
+    {
+        auto text = Caitlyn::MakePooledText();
+        ASSERT_TRUE(text.IsEmpty());
+        ASSERT_TRUE(text.View().data() == data);
+        text.Append("reused");
+        ASSERT_EQ("reused"_str, text.str());
+    }
+    auto stats = Caitlyn::StringBuilderPool::Stats();
+    ASSERT_EQ(before.borrowed + 2, stats.borrowed);
+    ASSERT_EQ(before.reused + 1, stats.reused);
+
+    // Buffers past the retain limit are freed on return
+    const Caitlyn::SizeType limit = Caitlyn::StringBuilderPool::RetainLimit();
+    Caitlyn::StringBuilderPool::SetRetainLimit(64);
+    {
+        auto text = Caitlyn::MakePooledText();
+        text.Append(Caitlyn::String(1000, 'y'));
+    }
+    stats = Caitlyn::StringBuilderPool::Stats();
+    ASSERT_EQ(before.trimmed + 1, stats.trimmed);
+    ASSERT_TRUE(stats.high_water >= 1000);
+    ASSERT_EQ(0, stats.retained_bytes);
+    Caitlyn::StringBuilderPool::SetRetainLimit(limit);
+
+    // A released buffer belongs to the result
+    auto text = Caitlyn::MakePooledText("{}", "kept");
+    const Caitlyn::String released = text.Release();
+    ASSERT_EQ("kept"_str, released);
+}
@@ -0,0 +1,49 @@
+#include <thread>
+#include <vector>
+
+#include "Caitlyn/__Core/String.h"
+#include "Caitlyn/__Testing/Macro.h"
+
+TEST(StringPoolTest, Intern)
+{
+    Caitlyn::StringPool pool;
+    const Caitlyn::String name = "requests.total";
+    const Caitlyn::Atom first = pool.Intern(name);
+    const Caitlyn::Atom second = pool.Intern("requests.total");
+
+    ASSERT_TRUE(first == second);
+    ASSERT_EQ(first.data(), second.data());
+    ASSERT_TRUE(first != pool.Intern("requests.failed"));
+    ASSERT_TRUE(first.View() == name);
+    ASSERT_EQ(2, pool.Size());
+    ASSERT_TRUE(pool.Find("requests.failed").NotEmpty());
+    ASSERT_TRUE(pool.Find("unknown").IsEmpty());
+    ASSERT_TRUE(pool.Intern(Caitlyn::String(20000, 'x')).View() == Caitlyn::String(20000, 'x'));
+    ASSERT_TRUE(Caitlyn::Intern("ключ") == Caitlyn::Intern("ключ"));
+}
+
+TEST(StringPoolTest, Threads)
+{
+    Caitlyn::StringPool pool;
+    std::vector<std::thread> threads;
+    std::vector<Caitlyn::Atom> atoms(4);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back(
+            [&pool, &atoms, i]
+            {
+                for (int key = 0; key < 1000; ++key)
+                {
+                    pool.Intern(Caitlyn::String{std::to_string(key)});
+                }
+                atoms[i] = pool.Intern("shared");
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    ASSERT_EQ(1001, pool.Size());
+    ASSERT_TRUE(atoms[0] == atoms[3]);
+}
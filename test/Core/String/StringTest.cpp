@@ -1,3 +1,8 @@
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
 #include "Caitlyn/__Core/String.h"
 #include "Caitlyn/__Core/IO.h"
 #include "Caitlyn/__Testing/Macro.h"
@@ -27,3 +32,298 @@ TEST(StringTest, Sample)
     }
     ASSERT_TRUE(data.EndsWith("🍉"));
 }
+
+TEST(StringTest, ByteStorage)
+{
+    Caitlyn::String data = "Привет, мир";
+
+    ASSERT_EQ(11, data.Length());
+    ASSERT_EQ(20, data.ByteCount());
+    ASSERT_FALSE(data.IsAscii());
+
+    data[0] = "Z";
+    ASSERT_EQ("Zривет, мир"_str, data);
+    ASSERT_EQ(19, data.ByteCount());
+
+    data.Insert(8, "🙂");
+    ASSERT_EQ("Zривет, 🙂мир"_str, data);
+    ASSERT_EQ(Caitlyn::Char{"р"}, *data.rbegin());
+    ASSERT_EQ(8, data.ReverseFind("🙂"));
+
+    bool thrown = false;
+    try
+    {
+        Caitlyn::String invalid{"\xE4\xB8"};
+    }
+    catch (const std::runtime_error&)
+    {
+        thrown = true;
+    }
+    ASSERT_TRUE(thrown);
+}
+
+TEST(StringTest, SmallStorage)
+{
+    Caitlyn::String data = "short json key 23 bytes";
+    ASSERT_EQ(23, data.ByteCount());
+
+    data += data;
+    ASSERT_EQ("short json key 23 bytesshort json key 23 bytes"_str, data);
+
+    data.Insert(5, data.Substring(0, 5));
+    ASSERT_TRUE(data.StartsWith("shortshort json"));
+
+    Caitlyn::String moved = std::move(data);
+    ASSERT_TRUE(data.IsEmpty());
+    ASSERT_EQ(51, moved.Length());
+
+    ASSERT_TRUE(sizeof(Caitlyn::Char) <= 8);
+    ASSERT_EQ(Caitlyn::Char{"世"}, Caitlyn::Char{Caitlyn::CodePoint{0x4E16}});
+}
+
+TEST(StringTest, RepeatedAppend)
+{
+    Caitlyn::String data;
+    Caitlyn::SizeType capacity = data.Capacity();
+    int reallocations = 0;
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        data.Append(1, "é");
+
+        if (data.Capacity() != capacity)
+        {
+            capacity = data.Capacity();
+            ++reallocations;
+        }
+    }
+    data.Append(3, 'x');
+    data.Append(2, "🙂");
+
+    ASSERT_EQ(2005, data.Length());
+    ASSERT_EQ(4011, data.ByteCount());
+    ASSERT_TRUE(data.EndsWith("éxxx🙂🙂"));
+    ASSERT_LE(reallocations, 12);
+}
+
+TEST(StringTest, Concatenation)
+{
+    const Caitlyn::String host = "мир.example";
+    const std::string path = "/путь";
+    const Caitlyn::StringView query{"?q=1"};
+
+    const Caitlyn::String url = "https://" + host + path + query + Caitlyn::String{"#top"};
+    ASSERT_EQ("https://мир.example/путь?q=1#top"_str, url);
+    ASSERT_EQ(32, url.Length());
+
+    Caitlyn::String buffer;
+    buffer.Reserve(64);
+    buffer.Append("abc");
+    const char* data = buffer.data();
+    const Caitlyn::String joined = std::move(buffer) + "def" + host + Caitlyn::String(10, 'x');
+    ASSERT_TRUE(joined.data() == data);
+    ASSERT_EQ(27, joined.Length());
+
+    const Caitlyn::String prefixed = "head " + Caitlyn::String(30, 'y');
+    ASSERT_EQ(35, prefixed.Length());
+    ASSERT_TRUE(prefixed.StartsWith("head y"));
+
+    ASSERT_EQ("a-мир.example-/путь"_str, Caitlyn::Concat("a-", host, "-", path));
+    ASSERT_EQ(""_str, Caitlyn::Concat());
+}
+
+TEST(StringTest, Comparison)
+{
+    const Caitlyn::String text = "мир";
+    const std::string same = "мир";
+    const std::string longer = "мир!";
+
+    ASSERT_TRUE(text == "мир");
+    ASSERT_TRUE("мир" == text);
+    ASSERT_TRUE(text == same);
+    ASSERT_TRUE(same == text);
+    ASSERT_TRUE(text != longer);
+    ASSERT_TRUE(text < longer);
+    ASSERT_TRUE(text > "ми");
+    ASSERT_TRUE(text <= "мир");
+    ASSERT_TRUE(text >= same);
+    ASSERT_FALSE(text == "ми\0р");
+
+    ASSERT_EQ(0, text.Compare(same));
+    ASSERT_TRUE(text.Compare("мира") < 0);
+    ASSERT_TRUE(text.Compare("world"_str) > 0);
+    ASSERT_TRUE(text.Compare(Caitlyn::StringView{"миф"}) < 0);
+
+    std::ostringstream stream;
+    stream << text << '|' << std::setw(5) << std::left << "ok"_str << '|';
+    ASSERT_EQ(std::string{"мир|ok   |"}, stream.str());
+}
+
+TEST(StringTest, Hashing)
+{
+    const Caitlyn::String key = "ключ";
+    const Caitlyn::StringView view = key;
+
+    ASSERT_EQ(std::hash<Caitlyn::String>{}(key), std::hash<Caitlyn::StringView>{}(view));
+    ASSERT_EQ(Caitlyn::Hash(view), Caitlyn::ImmutableString{"ключ"}.Hash());
+    ASSERT_TRUE(Caitlyn::Hash(view, 1) != Caitlyn::Hash(view, 2));
+    ASSERT_TRUE(Caitlyn::Hash("") != Caitlyn::Hash("a"));
+    ASSERT_TRUE(Caitlyn::Hash("0123456789abcdefg") != Caitlyn::Hash("0123456789abcdefh"));
+    ASSERT_EQ(std::hash<Caitlyn::Char>{}(Caitlyn::Char{"ж"}), Caitlyn::Hash("ж"));
+
+    std::unordered_map<Caitlyn::String, int> counts;
+    ++counts[key];
+    ++counts["ключ"];
+    ASSERT_EQ(1, counts.size());
+    ASSERT_EQ(2, counts[key]);
+
+    const Caitlyn::StringHash seeded{Caitlyn::RandomHashSeed()};
+    std::unordered_map<Caitlyn::String, int, Caitlyn::StringHash> table(16, seeded);
+    table[key] = 1;
+    ASSERT_EQ(1, table.count("ключ"));
+    ASSERT_EQ(seeded.Seed(), table.hash_function().Seed());
+}
+
+TEST(StringTest, Search)
+{
+    Caitlyn::String log;
+
+    for (int i = 0; i < 40; ++i)
+    {
+        log.Append("INFO запрос обработан; ");
+    }
+    log.Append("ERROR тайм-аут 🙂 ");
+    log.Append(log.Substring(0, 100));
+
+    ASSERT_EQ(920, log.Find("ERROR"));
+    ASSERT_EQ(935, log.Find("🙂"));
+    ASSERT_TRUE(log.Contains("тайм-аут 🙂 INFO"));
+    ASSERT_FALSE(log.Contains("тайм-аут 🙂 ERROR"));
+    ASSERT_EQ(23, log.Find("INFO", 1));
+    ASSERT_EQ(1029, log.ReverseFind("INFO"));
+    ASSERT_EQ(1006, log.ReverseFind("INFO", 1028));
+    ASSERT_EQ(920, log.ReverseFind("E"));
+
+    // Patterns longer than the filtered ones
+    const Caitlyn::String needle = log.Substring(900, 90);
+    ASSERT_EQ(900, log.Find(needle));
+    ASSERT_EQ(900, log.ReverseFind(needle));
+    ASSERT_EQ(Caitlyn::String::NPosition, log.Find(needle, 901));
+    ASSERT_EQ(Caitlyn::String::NPosition, log.Find(needle + "x"));
+
+    const Caitlyn::String periodic(200, 'a');
+    Caitlyn::String text = periodic + "b" + periodic + periodic;
+    ASSERT_EQ(201, text.Find(periodic, 1));
+    ASSERT_EQ(401, text.ReverseFind(periodic));
+    ASSERT_EQ(301, text.Find(periodic, 301));
+}
+
+TEST(StringTest, CodePointIndex)
+{
+    Caitlyn::String data;
+    for (int i = 0; i < 100; ++i)
+    {
+        data += "aé世🙂";
+    }
+    ASSERT_EQ(400, data.Length());
+    ASSERT_EQ(Caitlyn::Char{"世"}, data[258]);
+    ASSERT_EQ(Caitlyn::Char{"🙂"}, data.At(399));
+    ASSERT_EQ(101, data.Find("é", 100));
+    ASSERT_EQ("🙂a"_str, data.Substring(331, 2));
+
+    data[1] = "e";
+    ASSERT_EQ(Caitlyn::Char{"世"}, data[258]);
+    ASSERT_EQ(398, data.ReverseFind("世"));
+}
+
+TEST(StringTest, Utf8Validation)
+{
+    const auto is_valid = [](const std::string& bytes)
+    {
+        try
+        {
+            Caitlyn::String{bytes};
+            return true;
+        }
+        catch (const std::runtime_error&)
+        {
+            return false;
+        }
+    };
+    const std::string ascii(100, 'a');
+    const std::string mixed = ascii + "Привет, 世界! 🙂" + ascii;
+
+    ASSERT_EQ(100, Caitlyn::String{ascii}.Length());
+    ASSERT_EQ(213, Caitlyn::String{mixed}.Length());
+    ASSERT_TRUE(is_valid(ascii + "\xF4\x8F\xBF\xBF"));
+    ASSERT_FALSE(is_valid(ascii + "\xC0\xAF"));
+    ASSERT_FALSE(is_valid(ascii + "\xE0\x80\xAF" + ascii));
+    ASSERT_FALSE(is_valid(ascii + "\xED\xA0\x80"));
+    ASSERT_FALSE(is_valid(ascii + "\xF4\x90\x80\x80"));
+    ASSERT_FALSE(is_valid(ascii + "\xF5\x80\x80\x80"));
+    ASSERT_FALSE(is_valid(mixed + "\xE4\xB8"));
+    ASSERT_FALSE(is_valid(std::string(31, 'a') + "\xF0\x9F" + ascii));
+    ASSERT_FALSE(is_valid(ascii + "\x80" + ascii));
+}
+
+TEST(StringTest, CaseConversion)
+{
+    const Caitlyn::String header = "Content-Type: text/html; charset=utf-8 | Größe: Ωμέγα, Ёж";
+
+    ASSERT_EQ("CONTENT-TYPE: TEXT/HTML; CHARSET=UTF-8 | GRÖẞE: ΩΜΈΓΑ, ЁЖ"_str, header.ToUppercase());
+    ASSERT_EQ("content-type: text/html; charset=utf-8 | größe: ωμέγα, ёж"_str, header.ToLowercase());
+    ASSERT_EQ(header.Length(), header.ToUppercase().Length());
+    ASSERT_EQ("K"_str, "K"_str.ToLowercase().ToUppercase());
+}
+
+TEST(StringTest, IgnoreCase)
+{
+    const Caitlyn::String header = "Content-Type: text/html; charset=utf-8 | Größe: Ωμέγα, Ёж";
+
+    ASSERT_TRUE(Caitlyn::EqualsIgnoreCase(header, header.ToUppercase()));
+    ASSERT_TRUE(Caitlyn::EqualsIgnoreCase("\u212Aelvin", "kELVIN"));
+    ASSERT_FALSE(Caitlyn::EqualsIgnoreCase("straße", "strasse"));
+    ASSERT_FALSE(Caitlyn::EqualsIgnoreCase("İ", "i"));
+    ASSERT_TRUE(Caitlyn::EqualsIgnoreCase("ᏣᎳᎩ", "ꮳꮃꭹ"));
+    ASSERT_EQ(0x13A0, Caitlyn::FoldCase(0xAB70));
+    ASSERT_EQ(0x13F0, Caitlyn::FoldCase(0x13F8));
+    ASSERT_EQ(0x13A0, Caitlyn::FoldCase(0x13A0));
+    ASSERT_TRUE(Caitlyn::StartsWithIgnoreCase(header, "CONTENT-type"));
+    ASSERT_FALSE(Caitlyn::StartsWithIgnoreCase("Content", "content-type"));
+
+    ASSERT_EQ(header.Find("Größe"), Caitlyn::FindIgnoreCase(header, "GRÖẞE"));
+    ASSERT_EQ(header.Find("Ωμέγα"), Caitlyn::FindIgnoreCase(header, "ΩΜΈΓΑ"));
+    ASSERT_EQ(header.Find("utf"), Caitlyn::FindIgnoreCase(header, "UTF", 10));
+    ASSERT_EQ(8, Caitlyn::FindIgnoreCase("Mass of ſtars", "STAR"));
+    ASSERT_EQ(Caitlyn::String::NPosition, Caitlyn::FindIgnoreCase(header, "text/xml"));
+
+    ASSERT_EQ(Caitlyn::HashIgnoreCase(header), Caitlyn::HashIgnoreCase(header.ToLowercase()));
+    ASSERT_TRUE(Caitlyn::HashIgnoreCase("content-type") != Caitlyn::HashIgnoreCase("content-length"));
+
+    std::unordered_map<Caitlyn::String, int, Caitlyn::IgnoreCaseHash, Caitlyn::IgnoreCaseEqual> headers;
+    headers["Content-Length"] = 42;
+    ASSERT_EQ(1, headers.count("CONTENT-LENGTH"));
+
+    // The byte search for ASCII first letters relies on these being the only other code points
+    // that fold to ASCII
+    for (Caitlyn::CodePoint cp = 0x80; cp < 0x110000; ++cp)
+    {
+        if (Caitlyn::FoldCase(cp) < 0x80)
+        {
+            ASSERT_TRUE(cp == 0x017F || cp == 0x212A);
+        }
+    }
+}
+
+TEST(StringTest, BulkClassification)
+{
+    const Caitlyn::String padding = " \t\r\n                             　  value 42";
+    const Caitlyn::String digits = "0123456789012345678901234567890123456789١٢٣x7";
+
+    ASSERT_EQ(36, Caitlyn::SkipWhile(padding, Caitlyn::CharClass::Space));
+    ASSERT_EQ(37, Caitlyn::CountIf(padding, Caitlyn::CharClass::Space));
+    ASSERT_EQ(43, Caitlyn::SkipWhile(digits, Caitlyn::CharClass::Digit));
+    ASSERT_EQ(44, Caitlyn::CountIf(digits, Caitlyn::CharClass::Digit));
+    ASSERT_EQ(0, Caitlyn::SkipWhile("", Caitlyn::CharClass::Space));
+    ASSERT_TRUE(Caitlyn::IsNumber("١٢٣"));
+}
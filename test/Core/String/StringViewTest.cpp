@@ -0,0 +1,97 @@
+#include <string>
+#include <vector>
+
+#include "Caitlyn/__Core/String.h"
+#include "Caitlyn/__Testing/Macro.h"
+
+TEST(StringViewTest, Sample)
+{
+    const Caitlyn::String data = "Hello, 世界! 🙂";
+    const Caitlyn::StringView view = data.SubstringView(7);
+
+    ASSERT_EQ(data.data() + 7, view.data());
+    ASSERT_EQ(5, view.Length());
+    ASSERT_TRUE(view.StartsWith("世界"));
+    ASSERT_TRUE(view.EndsWith("🙂"));
+    ASSERT_TRUE(view.Contains("!"));
+    ASSERT_EQ(4, view.Find("🙂"));
+    ASSERT_EQ(Caitlyn::Char{"界"}, view[1]);
+    ASSERT_TRUE(view.Substring(0, 2) == "世界");
+    ASSERT_TRUE(data == data.View());
+    ASSERT_EQ("世界! 🙂"_str, Caitlyn::String{view});
+
+    Caitlyn::SizeType count = 0;
+    for (const auto& ch : view)
+    {
+        count += ch.size();
+    }
+    ASSERT_EQ(view.ByteCount(), count);
+}
+
+TEST(StringViewTest, Split)
+{
+    const Caitlyn::String line = "ts=1|level=warn||msg=ок|";
+    const auto tokens = Caitlyn::SplitView(line, "|");
+
+    ASSERT_EQ(4, tokens.size());
+    ASSERT_TRUE(tokens[0] == "ts=1");
+    ASSERT_TRUE(tokens[2].IsEmpty());
+    ASSERT_TRUE(tokens[3] == "msg=ок");
+    ASSERT_EQ(line.data() + 5, tokens[1].data());
+}
+
+TEST(StringViewTest, SplitRange)
+{
+    const Caitlyn::String line = "ts=1 → level=warn →→ msg=ок →";
+    std::vector<Caitlyn::StringView> tokens;
+
+    for (const auto& token : Caitlyn::Split(line, Caitlyn::CodePoint{0x2192}))
+    {
+        tokens.push_back(token);
+    }
+    ASSERT_EQ(4, tokens.size());
+    ASSERT_TRUE(tokens[0] == "ts=1 ");
+    ASSERT_TRUE(tokens[2].IsEmpty());
+    ASSERT_EQ(8, tokens[3].Length());
+    ASSERT_EQ(line.data() + 8, tokens[1].data());
+
+    const auto fields = Caitlyn::Split(line, "→", Caitlyn::SplitMode::SkipEmpty).ToVector();
+    ASSERT_EQ(3, fields.size());
+    ASSERT_TRUE(fields[2] == " msg=ок ");
+
+    const auto isSpace = [](Caitlyn::CodePoint cp) { return Caitlyn::IsSpace(cp); };
+    const auto words = Caitlyn::SplitIf("  one\ttwo  три ", isSpace, Caitlyn::SplitMode::SkipEmpty);
+    const auto list = words.ToVector();
+    ASSERT_EQ(3, list.size());
+    ASSERT_TRUE(list[2] == "три");
+
+    ASSERT_TRUE(Caitlyn::Split("", ",", Caitlyn::SplitMode::SkipEmpty).ToVector().empty());
+}
+
+TEST(StringViewTest, SplittersAgree)
+{
+    const char* const samples[] = {"", ",", "a", "a,", "a,,", ",a", "a,,b", "a,b,", ",,"};
+
+    for (const char* sample : samples)
+    {
+        const auto range = Caitlyn::Split(sample, ",").ToVector();
+        const auto byCodePoint = Caitlyn::Split(sample, Caitlyn::CodePoint{','}).ToVector();
+        const auto views = Caitlyn::SplitView(sample, ",");
+        const auto strings = Caitlyn::Split(std::string{sample}, ',');
+
+        ASSERT_EQ(strings.size(), range.size());
+        ASSERT_EQ(strings.size(), byCodePoint.size());
+        ASSERT_EQ(strings.size(), views.size());
+
+        for (Caitlyn::SizeType i = 0; i < strings.size(); ++i)
+        {
+            ASSERT_TRUE(range[i] == strings[i]);
+            ASSERT_TRUE(byCodePoint[i] == strings[i]);
+            ASSERT_TRUE(views[i] == strings[i]);
+        }
+    }
+    ASSERT_TRUE(Caitlyn::Split("", ",").ToVector().empty());
+    ASSERT_EQ(1, Caitlyn::Split("a,", ",").ToVector().size());
+    ASSERT_EQ(2, Caitlyn::SplitView("a,,", ",").size());
+    ASSERT_EQ(2, Caitlyn::Split(std::string{",a"}, ',').size());
+}
@@ -1,3 +1,5 @@
+#include <cstdint>
+
 #include "Caitlyn/__Serializing/Json.h"
 #include "Caitlyn/__Testing/Macro.h"
 
@@ -27,3 +29,13 @@ TEST(JsonTest, InitNative)
     });
     ASSERT_FALSE(config.HasError());
 }
+
+TEST(JsonTest, InitIntegers)
+{
+    auto config = Caitlyn::Json::MakeDocument();
+    config["a"] = -5;
+    config["b"] = INT64_MIN;
+    config["c"] = 0;
+
+    ASSERT_EQ("{\"a\":-5,\"b\":-9223372036854775808,\"c\":0}"_str, config.ToString());
+}